@@ -35,7 +35,15 @@ public class LODProfileTool : ModuleRules
 				"AssetRegistry",     // Enumerate static meshes
 				"Projects",          // Settings panel
 				"InputCore",
-				"LevelEditor"        // Toolbar or tab
+				"LevelEditor",       // Toolbar or tab
+				"Json",              // Commandlet reports
+				"JsonUtilities",     // Profile override files
+				"SourceControl",     // Batched checkout before saving
+				"MeshDescription",   // Synthetic benchmark meshes
+				"StaticMeshDescription", // FStaticMeshAttributes
+				"InterchangeCore",   // Import pipeline that sets up LODs before the first build
+				"SkeletalMeshUtilitiesCommon", // FLODUtilities for skeletal LOD regeneration
+				"TargetPlatform"     // Running platform for skeletal LOD regeneration
 			}
 		);
 	}
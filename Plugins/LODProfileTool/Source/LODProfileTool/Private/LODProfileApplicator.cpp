@@ -3,27 +3,83 @@
 #include "LODProfileApplicator.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "LODProfileAssetFilter.h"
+#include "LODProfileDDCStats.h"
+#include "LODProfileEstimate.h"
+#include "LODProfileJobJournal.h"
+#include "LODProfilePackageSaver.h"
+#include "LODProfilePlatforms.h"
+#include "LODProfileReport.h"
+#include "LODProfileRuleSet.h"
+#include "LODProfileSections.h"
+#include "LODProfileSkeletalMesh.h"
+#include "LODProfileStale.h"
+#include "LODProfileStamp.h"
 #include "LODProfileTool.h"
 #include "LODProfileToolSettings.h"
+#include "Misc/EngineVersionComparison.h"
 #include "Misc/ScopedSlowTask.h"
+#include "MeshDescription.h"
+#include "PackageTools.h"
 #include "StaticMeshResources.h"
 #include "UObject/Package.h"
 #include "Editor.h"
 #include "EditorFramework/AssetImportData.h"
-#include "FileHelpers.h"
 #include "Subsystems/AssetEditorSubsystem.h"
+#include "Engine/SkeletalMesh.h"
 #include "Engine/StaticMesh.h"
+#include "StaticMeshCompiler.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("LODProfileTool"), STATGROUP_LODProfileTool, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Load Mesh"), STAT_LODProfile_LoadMesh, STATGROUP_LODProfileTool);
+DECLARE_CYCLE_STAT(TEXT("Configure Source Models"), STAT_LODProfile_Configure, STATGROUP_LODProfileTool);
+DECLARE_CYCLE_STAT(TEXT("Launch Builds"), STAT_LODProfile_LaunchBuilds, STATGROUP_LODProfileTool);
+DECLARE_CYCLE_STAT(TEXT("Save Package"), STAT_LODProfile_Save, STATGROUP_LODProfileTool);
+DECLARE_CYCLE_STAT(TEXT("Collect Garbage"), STAT_LODProfile_CollectGarbage, STATGROUP_LODProfileTool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Meshes Applied"), STAT_LODProfile_NumApplied, STATGROUP_LODProfileTool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Meshes Skipped"), STAT_LODProfile_NumSkipped, STATGROUP_LODProfileTool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Meshes Failed"), STAT_LODProfile_NumFailed, STATGROUP_LODProfileTool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Builds In Flight"), STAT_LODProfile_BuildsInFlight, STATGROUP_LODProfileTool);
 
 namespace
 {
-	float GetScreenSize(const FLODProfile& Profile, int32 LODIndex)
+	constexpr double MillisecondsPerSecond = 1000.0;
+
+	/** Triangles per LOD of the current render data. Blocks until a pending build of the mesh finishes. */
+	TArray<int32> GetLODTriangleCounts(const UStaticMesh* Mesh)
 	{
-		if (Profile.ScreenSizes.IsValidIndex(LODIndex))
+		TArray<int32> Counts;
+		if (const FStaticMeshRenderData* RenderData = Mesh->GetRenderData())
 		{
-			return Profile.ScreenSizes[LODIndex];
+			for (const FStaticMeshLODResources& LODResources : RenderData->LODResources)
+			{
+				Counts.Add(LODResources.GetNumTriangles());
+			}
 		}
-		// Fallback: decreasing sizes
-		return LODIndex == 0 ? 1.0f : FMath::Max(0.0f, 1.0f - (LODIndex * 0.25f));
+		return Counts;
+	}
+
+	/** Registry tag with the number of UV channels of LOD0. */
+	const FName UVChannelsTag(TEXT("UVChannels"));
+	const FName VerticesTag(TEXT("Vertices"));
+
+	/**
+	 * Vertex and index buffer bytes of one LOD with default build settings: float positions, packed normal and tangent,
+	 * half-precision UVs, and 16-bit indices when the vertex count allows it.
+	 */
+	int64 EstimateLODBytes(int64 NumTriangles, int64 NumVertices, int32 NumUVChannels)
+	{
+		const int64 VertexStride = 12 + 8 + 4 * FMath::Max(1, NumUVChannels);
+		const int64 IndexSize = NumVertices <= MAX_uint16 ? 2 : 4;
+		return NumVertices * VertexStride + NumTriangles * 3 * IndexSize;
+	}
+
+	double GetUsedMemoryMB()
+	{
+		return double(FPlatformMemory::GetStats().UsedPhysical) / (1024.0 * 1024.0);
 	}
 
 	float GetReductionPercent(const FLODProfile& Profile, int32 LODIndex)
@@ -34,6 +90,76 @@ namespace
 		}
 		return 100.0f;
 	}
+
+	/**
+	 * Triangles of the LOD0 source, which only the triangle budget and screen density modes need; 0 otherwise. The
+	 * built LOD0 (what the registry's Triangles tag records) matches the source unless LOD0 is reduced or Nanite
+	 * replaced it with a fallback, so the source description, which may have to be loaded, is only read then.
+	 * Counting the reduced LOD0 would make resolved percentages drift between runs.
+	 */
+	int32 GetSourceTriangleCount(const UStaticMesh* Mesh, const FLODProfile& Profile)
+	{
+		if (Profile.ReductionMode == ELODProfileReductionMode::Percent || !Profile.bEnableReduction)
+		{
+			return 0;
+		}
+
+		const FStaticMeshRenderData* RenderData = Mesh->GetRenderData();
+		const bool bBuiltLOD0IsSource = !Mesh->IsReductionActive(0) && !Mesh->IsNaniteEnabled();
+		if (bBuiltLOD0IsSource && RenderData && RenderData->LODResources.Num() > 0)
+		{
+			return RenderData->LODResources[0].GetNumTriangles();
+		}
+		if (const FMeshDescription* MeshDescription = Mesh->GetMeshDescription(0))
+		{
+			return MeshDescription->Triangles().Num();
+		}
+		return RenderData && RenderData->LODResources.Num() > 0 ? RenderData->LODResources[0].GetNumTriangles() : 0;
+	}
+
+	/** Triangle budget of the LOD in the non-percent modes. 0 or less means full detail. */
+	double GetTriangleBudget(const FLODProfile& Profile, int32 LODIndex)
+	{
+		switch (Profile.ReductionMode)
+		{
+		case ELODProfileReductionMode::TriangleBudget:
+			return Profile.TriangleBudgets.IsValidIndex(LODIndex) ? Profile.TriangleBudgets[LODIndex] : 0.0;
+		case ELODProfileReductionMode::ScreenDensity:
+		{
+			const float Density = Profile.TriangleDensities.IsValidIndex(LODIndex) ? Profile.TriangleDensities[LODIndex] : 0.0f;
+			const float ScreenSize = FLODProfileApplicator::GetScreenSize(Profile, LODIndex);
+			return double(Density) * ScreenSize * ScreenSize;
+		}
+		default:
+			return 0.0;
+		}
+	}
+
+}
+
+float FLODProfileApplicator::GetScreenSize(const FLODProfile& Profile, int32 LODIndex)
+{
+	if (Profile.ScreenSizes.IsValidIndex(LODIndex))
+	{
+		return Profile.ScreenSizes[LODIndex];
+	}
+	// Fallback: decreasing sizes
+	return LODIndex == 0 ? 1.0f : FMath::Max(0.0f, 1.0f - (LODIndex * 0.25f));
+}
+
+float FLODProfileApplicator::ResolveReductionPercent(const FLODProfile& Profile, int32 LODIndex, int32 SourceTriangles)
+{
+	if (Profile.ReductionMode == ELODProfileReductionMode::Percent)
+	{
+		return FMath::Clamp(GetReductionPercent(Profile, LODIndex), 0.0f, 100.0f);
+	}
+
+	const double Budget = GetTriangleBudget(Profile, LODIndex);
+	if (Budget <= 0.0 || SourceTriangles <= 0)
+	{
+		return 100.0f;
+	}
+	return float(FMath::Clamp(100.0 * Budget / SourceTriangles, 0.0, 100.0));
 }
 
 bool FLODProfileApplicator::ValidateProfile(const FLODProfile& Profile, FString& OutError)
@@ -60,7 +186,79 @@ bool FLODProfileApplicator::ValidateProfile(const FLODProfile& Profile, FString&
 		}
 	}
 
-	if (Profile.bEnableReduction)
+	if (Profile.bDeriveScreenSizesFromError && (Profile.MaxPixelError <= 0.0f || Profile.ReferenceScreenHeight <= 0.0f))
+	{
+		OutError = TEXT("MaxPixelError and ReferenceScreenHeight must be greater than zero when deriving screen sizes.");
+		return false;
+	}
+
+	if (Profile.bEnableReduction && Profile.ReductionMode == ELODProfileReductionMode::TriangleBudget)
+	{
+		for (int32 Index = 0; Index < Profile.NumLODs; ++Index)
+		{
+			if (!Profile.TriangleBudgets.IsValidIndex(Index) || Profile.TriangleBudgets[Index] < 0)
+			{
+				OutError = FString::Printf(TEXT("Triangle budget at index %d is missing or negative."), Index);
+				return false;
+			}
+		}
+	}
+
+	if (Profile.bEnableReduction && Profile.ReductionMode == ELODProfileReductionMode::ScreenDensity)
+	{
+		for (int32 Index = 0; Index < Profile.NumLODs; ++Index)
+		{
+			if (!Profile.TriangleDensities.IsValidIndex(Index) || Profile.TriangleDensities[Index] < 0.0f)
+			{
+				OutError = FString::Printf(TEXT("Triangle density at index %d is missing or negative."), Index);
+				return false;
+			}
+		}
+	}
+
+	if (!FLODProfilePlatforms::Validate(Profile, OutError))
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Profile.LODSections.Num(); ++Index)
+	{
+		if (Profile.LODSections[Index].MaxSections < 0)
+		{
+			OutError = FString::Printf(TEXT("Max sections at LOD %d must not be negative."), Index);
+			return false;
+		}
+	}
+
+	for (int32 Index = 0; Index < Profile.Skeletal.VertexPercents.Num(); ++Index)
+	{
+		const float Percent = Profile.Skeletal.VertexPercents[Index];
+		if (Percent < 0.0f || Percent > 100.0f)
+		{
+			OutError = FString::Printf(TEXT("Skeletal vertex percent at index %d is out of range [0,100]."), Index);
+			return false;
+		}
+	}
+	if (Profile.Skeletal.RemoveBonesFromLOD == 0 || Profile.Skeletal.RemoveBonesFromLOD < INDEX_NONE)
+	{
+		OutError = FString::Printf(TEXT("RemoveBonesFromLOD is %d; it must be -1 (off) or at least 1, since bones cannot be removed from LOD0."), Profile.Skeletal.RemoveBonesFromLOD);
+		return false;
+	}
+
+	const FLODProfileNaniteSettings& Nanite = Profile.Nanite;
+	if (Nanite.bApplyToNaniteMeshes && (Nanite.FallbackPercentTriangles < 0.0f || Nanite.FallbackPercentTriangles > 1.0f
+		|| Nanite.KeepPercentTriangles < 0.0f || Nanite.KeepPercentTriangles > 1.0f))
+	{
+		OutError = TEXT("Nanite fallback and keep percentages must be in range [0,1].");
+		return false;
+	}
+	if (Nanite.bApplyToNaniteMeshes && (Nanite.FallbackRelativeError < 0.0f || Nanite.TrimRelativeError < 0.0f))
+	{
+		OutError = TEXT("Nanite relative errors must not be negative.");
+		return false;
+	}
+
+	if (Profile.bEnableReduction && Profile.ReductionMode == ELODProfileReductionMode::Percent)
 	{
 		if (Profile.ReductionPercents.Num() < Profile.NumLODs)
 		{
@@ -81,49 +279,897 @@ bool FLODProfileApplicator::ValidateProfile(const FLODProfile& Profile, FString&
 	return true;
 }
 
-int32 FLODProfileApplicator::ApplyProfileToAssets(const FLODProfile& Profile, const TArray<FAssetData>& Assets, bool bAutoSave)
+int32 FLODProfileApplicator::ApplyProfileToAssets(const FLODProfile& Profile, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options, FLODProfileApplyReport* OutReport)
+{
+	FLODProfileApplyReport LocalReport;
+	FLODProfileApplyReport& Report = OutReport ? *OutReport : LocalReport;
+	const double RunStartTime = FPlatformTime::Seconds();
+
+	// Drop non-meshes and compliant meshes from registry tags before loading anything.
+	const TArray<FLODProfileAssetInfo> AssetInfos = FLODProfileAssetFilter::EvaluateAll(Assets, Profile, Options);
+	TArray<FAssetData> AssetsToProcess;
+	for (const FLODProfileAssetInfo& Info : AssetInfos)
+	{
+		if (Info.FilterResult == ELODProfileFilterResult::Process)
+		{
+			AssetsToProcess.Add(Info.AssetData);
+			continue;
+		}
+
+		if (Info.FilterResult == ELODProfileFilterResult::NotAMesh)
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("Skipping asset %s (not a static or skeletal mesh)."), *Info.AssetData.AssetName.ToString());
+		}
+		FLODProfileAssetReport& Entry = Report.Assets[Report.AddAsset(Info.AssetData.GetSoftObjectPath())];
+		Entry.Status = ELODProfileAssetStatus::Skipped;
+		Entry.Message = LexToString(Info.FilterResult);
+	}
+
+	TArray<FSoftObjectPath> PendingPaths;
+	PendingPaths.Reserve(AssetsToProcess.Num());
+	for (const FAssetData& AssetData : AssetsToProcess)
+	{
+		PendingPaths.Add(AssetData.GetSoftObjectPath());
+	}
+
+	FLODProfileJobJournal Journal = FLODProfileJobJournal::Create(Profile, Options, PendingPaths);
+	const int32 Successes = RunJob(Journal, AssetsToProcess, Report);
+
+	Report.TotalSeconds = FPlatformTime::Seconds() - RunStartTime;
+	FinishReport(Journal.Options, Journal.JobId.ToString(EGuidFormats::Digits), Report);
+	return Successes;
+}
+
+int32 FLODProfileApplicator::ResumeJob(FLODProfileJobJournal& Journal, FLODProfileApplyReport* OutReport)
+{
+	FLODProfileApplyReport LocalReport;
+	FLODProfileApplyReport& Report = OutReport ? *OutReport : LocalReport;
+	const double RunStartTime = FPlatformTime::Seconds();
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> Assets;
+	for (const FSoftObjectPath& AssetPath : Journal.Pending.Array())
+	{
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(AssetPath);
+		if (AssetData.IsValid())
+		{
+			Assets.Add(AssetData);
+		}
+		else
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("Pending asset %s no longer exists."), *AssetPath.ToString());
+			Journal.MarkFailed(AssetPath);
+		}
+	}
+	Assets.Sort([](const FAssetData& A, const FAssetData& B)
+	{
+		return A.PackageName.LexicalLess(B.PackageName);
+	});
+
+	UE_LOG(LogLODProfileTool, Log, TEXT("Resuming job %s: %d pending, %d completed, %d failed."),
+		*Journal.JobId.ToString(), Assets.Num(), Journal.Completed.Num(), Journal.Failed.Num());
+
+	Journal.State = ELODProfileJobState::Running;
+	Journal.ClaimOwnership();
+	const int32 Successes = RunJob(Journal, Assets, Report);
+
+	Report.TotalSeconds = FPlatformTime::Seconds() - RunStartTime;
+	FinishReport(Journal.Options, Journal.JobId.ToString(EGuidFormats::Digits), Report);
+	return Successes;
+}
+
+void FLODProfileApplicator::FinishReport(const FLODProfileApplyOptions& Options, const FString& RunName, FLODProfileApplyReport& Report)
 {
+	Report.PeakUsedMemoryMB = double(FPlatformMemory::GetStats().PeakUsedPhysical) / (1024.0 * 1024.0);
+
+	UE_LOG(LogLODProfileTool, Log, TEXT("LOD profile run: %d applied, %d skipped, %d failed in %.2fs (peak memory %.0f MB)."),
+		Report.CountWithStatus(ELODProfileAssetStatus::Applied),
+		Report.CountWithStatus(ELODProfileAssetStatus::Skipped),
+		Report.CountWithStatus(ELODProfileAssetStatus::Failed),
+		Report.TotalSeconds,
+		Report.PeakUsedMemoryMB);
+	if (FLODProfileDDCStats::IsAvailable() && Report.DDC.Hits + Report.DDC.Misses > 0)
+	{
+		UE_LOG(LogLODProfileTool, Log, TEXT("Derived data cache: %lld hit(s) (%.1f MB fetched), %lld miss(es) reduced locally, %.0f%% hit rate."),
+			Report.DDC.Hits, Report.DDC.HitMB, Report.DDC.Misses, Report.DDC.GetHitRate() * 100.0);
+	}
+
+	if (Options.bWriteReport && Report.Assets.Num() > 0)
+	{
+		const FString ReportPath = Report.SaveToDefaultLocation(FString::Printf(TEXT("LODProfile_%s_%s"),
+			*FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")), *RunName));
+		UE_LOG(LogLODProfileTool, Log, TEXT("Wrote LOD profile report to %s"), *FPaths::ConvertRelativePathToFull(ReportPath));
+	}
+}
+
+int32 FLODProfileApplicator::RunJob(FLODProfileJobJournal& Journal, const TArray<FAssetData>& AssetsToProcess, FLODProfileApplyReport& Report)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_RunJob);
+
+	const FLODProfile& Profile = Journal.Profile;
+	const FLODProfileApplyOptions& Options = Journal.Options;
+
+	// Progress is only durable once packages are on disk, so the journal is persisted with auto-save only.
+	// Without it, re-running the profile skips the meshes that are already stamped in memory.
+	const bool bPersistJournal = Options.bAutoSave && AssetsToProcess.Num() > 0;
+	if (bPersistJournal)
+	{
+		Journal.Save();
+		UE_LOG(LogLODProfileTool, Log, TEXT("Job %s journal: %s"), *Journal.JobId.ToString(), *Journal.GetFilename());
+	}
+
+	// Streaming windows bound peak memory: each window is loaded, built and saved, then released
+	// before the next one. Unsaved edits would be lost to garbage collection, so windows require auto-save.
+	const bool bStreaming = Options.bAutoSave && (Options.MaxAssetsPerWindow > 0 || Options.MemoryBudgetMB > 0);
+	if (!Options.bAutoSave && Options.MaxAssetsPerWindow > 0 && AssetsToProcess.Num() > Options.MaxAssetsPerWindow)
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Auto-save is disabled, so all %d meshes stay loaded until saved. Enable auto-save to apply in bounded-memory windows."), AssetsToProcess.Num());
+	}
+	const uint64 MemoryBudgetBytes = uint64(FMath::Max(0, Options.MemoryBudgetMB)) * 1024 * 1024;
+	uint64 BaselineUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	const FLODProfileDDCStats BaselineDDCStats = FLODProfileDDCStats::Capture();
+
 	int32 Successes = 0;
-	FScopedSlowTask Progress(Assets.Num(), NSLOCTEXT("LODProfileTool", "ApplyProfileProgress", "Applying LOD Profile..."));
-	const bool bShowProgress = Assets.Num() > 3;
+	// Batched mode reports progress twice per asset: once when loading, once when its build completes.
+	const float WorkPerAsset = Options.bBatchBuild ? 2.f : 1.f;
+	FScopedSlowTask Progress(AssetsToProcess.Num() * WorkPerAsset, NSLOCTEXT("LODProfileTool", "ApplyProfileProgress", "Applying LOD Profile..."));
+	const bool bShowProgress = AssetsToProcess.Num() > 3;
 	if (bShowProgress)
 	{
-		Progress.MakeDialog(/*AllowCancel=*/false);
+		Progress.MakeDialog(/*AllowCancel=*/true);
 	}
 
-	for (const FAssetData& AssetData : Assets)
+	bool bCancelled = false;
+	auto ShouldCancel = [&]()
 	{
-		if (bShowProgress)
+		if (bShowProgress && !bCancelled)
 		{
-			Progress.EnterProgressFrame(1.f, FText::FromName(AssetData.AssetName));
+			// Keeps the dialog responsive while waiting on builds.
+			Progress.EnterProgressFrame(0.f);
+			bCancelled = Progress.ShouldCancel();
 		}
+		return bCancelled;
+	};
+
+	const FString ProfileHash = FLODProfileStamp::HashProfile(Profile);
+	FLODProfilePackageSaver Saver(Options.bAsyncSave);
 
-		UStaticMesh* Mesh = Cast<UStaticMesh>(AssetData.GetAsset());
-		if (!Mesh)
+	auto CheckpointJournal = [&](bool bForce)
+	{
+		if (bPersistJournal)
 		{
-			UE_LOG(LogLODProfileTool, Warning, TEXT("Skipping asset %s (not a static mesh)."), *AssetData.AssetName.ToString());
-			continue;
+			// Completed entries must never reach the journal before their packages are on disk.
+			if (bForce)
+			{
+				Saver.Flush();
+				Journal.Save();
+			}
+			else
+			{
+				Journal.SaveThrottled(/*MinIntervalSeconds=*/5.0, Saver);
+			}
+		}
+	};
+
+	int32 NextAssetIndex = 0;
+	while (NextAssetIndex < AssetsToProcess.Num() && !bCancelled)
+	{
+		TArray<UPackage*> PackagesToSave;
+		TArray<int32> PackageReportIndices;
+		TArray<UPackage*> WindowPackages;
+		TArray<UStaticMesh*> MeshesToBuild;
+		TMap<UStaticMesh*, int32> ReportIndexByMesh;
+		int32 NumInWindow = 0;
+
+		while (NextAssetIndex < AssetsToProcess.Num())
+		{
+			if (ShouldCancel())
+			{
+				break;
+			}
+
+			if (bStreaming && NumInWindow > 0)
+			{
+				const bool bWindowFull = Options.MaxAssetsPerWindow > 0 && NumInWindow >= Options.MaxAssetsPerWindow;
+				const bool bOverBudget = MemoryBudgetBytes > 0 && FPlatformMemory::GetStats().UsedPhysical > BaselineUsedPhysical + MemoryBudgetBytes;
+				if (bWindowFull || bOverBudget)
+				{
+					break;
+				}
+			}
+
+			const FAssetData& AssetData = AssetsToProcess[NextAssetIndex++];
+			++NumInWindow;
+
+			if (bShowProgress)
+			{
+				Progress.EnterProgressFrame(1.f, FText::FromName(AssetData.AssetName));
+			}
+
+			const double AssetStartTime = FPlatformTime::Seconds();
+			const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+			const int32 ReportIndex = Report.AddAsset(AssetPath);
+
+			UObject* Asset = nullptr;
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_LoadMesh);
+				SCOPE_CYCLE_COUNTER(STAT_LODProfile_LoadMesh);
+				Asset = AssetData.GetAsset();
+			}
+			Report.Assets[ReportIndex].LoadMs = (FPlatformTime::Seconds() - AssetStartTime) * MillisecondsPerSecond;
+
+			if (Asset)
+			{
+				WindowPackages.AddUnique(Asset->GetOutermost());
+			}
+
+			UStaticMesh* Mesh = Cast<UStaticMesh>(Asset);
+			USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Asset);
+			if (!Mesh && !SkeletalMesh)
+			{
+				UE_LOG(LogLODProfileTool, Warning, TEXT("Failed to load mesh %s."), *AssetData.AssetName.ToString());
+				Report.Assets[ReportIndex].Message = TEXT("Failed to load");
+				Journal.MarkFailed(AssetPath);
+				INC_DWORD_STAT(STAT_LODProfile_NumFailed);
+				continue;
+			}
+
+			if (Options.bSkipUnchanged && IsMeshUpToDate(Asset, Profile, ProfileHash))
+			{
+				Report.Assets[ReportIndex].Status = ELODProfileAssetStatus::Skipped;
+				Report.Assets[ReportIndex].Message = TEXT("Up to date");
+				Report.Assets[ReportIndex].Seconds = FPlatformTime::Seconds() - AssetStartTime;
+				Journal.MarkCompleted(AssetPath);
+				INC_DWORD_STAT(STAT_LODProfile_NumSkipped);
+				continue;
+			}
+
+			// Skeletal LODs are regenerated synchronously, so they always take the sequential path.
+			if (SkeletalMesh || !Options.bBatchBuild)
+			{
+				FLODProfileAssetReport& Entry = Report.Assets[ReportIndex];
+				const bool bApplied = SkeletalMesh
+					? FLODProfileSkeletalMesh::Apply(SkeletalMesh, Profile, ProfileHash, Entry)
+					: ApplyProfileToMesh(Mesh, Profile, ProfileHash, Entry);
+				if (bShowProgress && Options.bBatchBuild)
+				{
+					Progress.EnterProgressFrame(1.f);
+				}
+				if (bApplied)
+				{
+					FLODProfileStamp::WriteSource(Asset, Options.ProfileSource, Options.ProfileVersion);
+					Entry.Status = ELODProfileAssetStatus::Applied;
+					PackagesToSave.Add(Asset->GetOutermost());
+					PackageReportIndices.Add(ReportIndex);
+					++Successes;
+					INC_DWORD_STAT(STAT_LODProfile_NumApplied);
+				}
+				else
+				{
+					Journal.MarkFailed(AssetPath);
+					INC_DWORD_STAT(STAT_LODProfile_NumFailed);
+				}
+				Entry.Seconds = FPlatformTime::Seconds() - AssetStartTime;
+				continue;
+			}
+
+			MeshesToBuild.Add(Mesh);
+			ReportIndexByMesh.Add(Mesh, ReportIndex);
+			Report.Assets[ReportIndex].Seconds = FPlatformTime::Seconds() - AssetStartTime;
 		}
 
-		if (ApplyProfileToMesh(Mesh, Profile, bAutoSave))
+		if (MeshesToBuild.Num() > 0)
 		{
-			++Successes;
+			if (Options.bAutoSave)
+			{
+				// One source control round-trip per window; saves then follow each finished build.
+				TArray<UPackage*> PackagesToCheckOut;
+				for (UStaticMesh* Mesh : MeshesToBuild)
+				{
+					PackagesToCheckOut.AddUnique(Mesh->GetOutermost());
+				}
+				Saver.CheckOut(PackagesToCheckOut);
+			}
+
+			// Meshes are only edited right before their build launches, so cancelling leaves the rest untouched.
+			BuildMeshes(MeshesToBuild, Options.MaxConcurrentBuilds,
+				[&](UStaticMesh* Mesh)
+				{
+					BeginMeshApply(Mesh, Profile, ProfileHash, Options, Report.Assets[ReportIndexByMesh.FindChecked(Mesh)]);
+				},
+				[&](UStaticMesh* Mesh, double BuildSeconds)
+				{
+					if (bShowProgress)
+					{
+						Progress.EnterProgressFrame(1.f, FText::FromString(Mesh->GetName()));
+					}
+
+					FLODProfileAssetReport& Entry = Report.Assets[ReportIndexByMesh.FindChecked(Mesh)];
+					Entry.BuildMs = BuildSeconds * MillisecondsPerSecond;
+					FinishMeshApply(Mesh, Profile, ProfileHash, Entry);
+
+					const double SaveStartTime = FPlatformTime::Seconds();
+					Mesh->MarkPackageDirty();
+					bool bSaved = true;
+					if (Options.bAutoSave)
+					{
+						TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_SavePackage);
+						SCOPE_CYCLE_COUNTER(STAT_LODProfile_Save);
+						bSaved = Saver.Save(Mesh->GetOutermost());
+					}
+
+					const double SaveSeconds = FPlatformTime::Seconds() - SaveStartTime;
+					Entry.SaveMs = SaveSeconds * MillisecondsPerSecond;
+					Entry.Seconds += BuildSeconds + SaveSeconds;
+					Entry.UsedMemoryMB = GetUsedMemoryMB();
+					if (!bSaved)
+					{
+						Entry.Message = TEXT("Failed to save");
+						Journal.MarkFailed(Entry.AssetPath);
+						INC_DWORD_STAT(STAT_LODProfile_NumFailed);
+						return;
+					}
+
+					++Successes;
+					INC_DWORD_STAT(STAT_LODProfile_NumApplied);
+					Entry.Status = ELODProfileAssetStatus::Applied;
+					Journal.MarkCompleted(Entry.AssetPath);
+					CheckpointJournal(/*bForce=*/false);
+				},
+				ShouldCancel);
+
+			if (bCancelled)
+			{
+				for (const TPair<UStaticMesh*, int32>& Pair : ReportIndexByMesh)
+				{
+					FLODProfileAssetReport& Entry = Report.Assets[Pair.Value];
+					if (Entry.Status == ELODProfileAssetStatus::Failed && Entry.Message.IsEmpty())
+					{
+						Entry.Status = ELODProfileAssetStatus::Skipped;
+						Entry.Message = TEXT("Cancelled");
+					}
+				}
+			}
+		}
+
+		if (Options.bAutoSave && PackagesToSave.Num() > 0)
+		{
+			Saver.CheckOut(PackagesToSave);
 		}
+		for (int32 Index = 0; Index < PackagesToSave.Num(); ++Index)
+		{
+			FLODProfileAssetReport& Entry = Report.Assets[PackageReportIndices[Index]];
+			if (Options.bAutoSave)
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_SavePackage);
+				SCOPE_CYCLE_COUNTER(STAT_LODProfile_Save);
+				const double SaveStartTime = FPlatformTime::Seconds();
+				const bool bSaved = Saver.Save(PackagesToSave[Index]);
+				const double SaveSeconds = FPlatformTime::Seconds() - SaveStartTime;
+				Entry.SaveMs = SaveSeconds * MillisecondsPerSecond;
+				Entry.Seconds += SaveSeconds;
+				if (!bSaved)
+				{
+					// The edit was counted as applied when it was made; a package that did not reach disk is not.
+					Entry.Status = ELODProfileAssetStatus::Failed;
+					Entry.Message = TEXT("Failed to save");
+					Journal.MarkFailed(Entry.AssetPath);
+					--Successes;
+					DEC_DWORD_STAT(STAT_LODProfile_NumApplied);
+					INC_DWORD_STAT(STAT_LODProfile_NumFailed);
+					continue;
+				}
+			}
+			Entry.UsedMemoryMB = GetUsedMemoryMB();
+			Journal.MarkCompleted(Entry.AssetPath);
+		}
+		CheckpointJournal(/*bForce=*/true);
+
+		if (bStreaming && NextAssetIndex < AssetsToProcess.Num() && !bCancelled)
+		{
+			// Release the window before loading the next one. Its packages were flushed by the checkpoint above.
+			PackagesToSave.Empty();
+			PackageReportIndices.Empty();
+			MeshesToBuild.Empty();
+			ReportIndexByMesh.Empty();
+			ReleasePackages(WindowPackages);
+
+			// Measure the next window from what is left, so memory held elsewhere does not shrink every later window to one mesh.
+			BaselineUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+			UE_LOG(LogLODProfileTool, Log, TEXT("Processed %d/%d meshes; released window of %d."), NextAssetIndex, AssetsToProcess.Num(), NumInWindow);
+		}
+	}
+	Saver.Flush();
+	Report.DDC += FLODProfileDDCStats::Capture() - BaselineDDCStats;
+
+	Journal.State = bCancelled && Journal.Pending.Num() > 0 ? ELODProfileJobState::Cancelled : ELODProfileJobState::Completed;
+	if (bPersistJournal)
+	{
+		Journal.Save();
+	}
+	if (bCancelled)
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("LOD profile job %s cancelled with %d asset(s) pending. Resume it from the LOD Profile tab or with -run=LODProfile -Resume=%s."),
+			*Journal.JobId.ToString(), Journal.Pending.Num(), *Journal.JobId.ToString(EGuidFormats::Digits));
+	}
+	return Successes;
+}
+
+int32 FLODProfileApplicator::ApplyProfileRules(const FLODProfileRuleSet& RuleSet, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options, FLODProfileApplyReport* OutReport)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_ApplyProfileRules);
+	FLODProfileApplyReport LocalReport;
+	FLODProfileApplyReport& Report = OutReport ? *OutReport : LocalReport;
+	const double RunStartTime = FPlatformTime::Seconds();
+
+	TArray<FAssetData> Unmatched;
+	TMap<FName, TArray<FAssetData>> Groups = RuleSet.Partition(Assets, Unmatched);
+	Groups.KeySort(FNameLexicalLess());
+	UE_LOG(LogLODProfileTool, Log, TEXT("%d rule(s) matched %d of %d asset(s) to %d profile(s)."),
+		RuleSet.NumRules(), Assets.Num() - Unmatched.Num(), Assets.Num(), Groups.Num());
+
+	for (const FAssetData& AssetData : Unmatched)
+	{
+		FLODProfileAssetReport& Entry = Report.Assets[Report.AddAsset(AssetData.GetSoftObjectPath())];
+		Entry.Status = ELODProfileAssetStatus::Skipped;
+		Entry.Message = TEXT("No matching rule");
+	}
+
+	// Each profile runs as its own job; the combined report is written once at the end.
+	FLODProfileApplyOptions GroupOptions = Options;
+	GroupOptions.bWriteReport = false;
+
+	int32 Successes = 0;
+	for (const TPair<FName, TArray<FAssetData>>& Group : Groups)
+	{
+		const FLODProfile* Profile = RuleSet.FindProfile(Group.Key);
+		if (!Profile)
+		{
+			continue;
+		}
+
+		UE_LOG(LogLODProfileTool, Log, TEXT("Applying LOD profile '%s' to %d asset(s)."), *Group.Key.ToString(), Group.Value.Num());
+		RuleSet.GetProfileSource(Group.Key, GroupOptions.ProfileSource, GroupOptions.ProfileVersion);
+		Successes += ApplyProfileToAssets(*Profile, Group.Value, GroupOptions, &Report);
+	}
+
+	Report.TotalSeconds = FPlatformTime::Seconds() - RunStartTime;
+	FinishReport(Options, TEXT("Rules"), Report);
+	return Successes;
+}
+
+int32 FLODProfileApplicator::RebuildStale(const FLODProfileStaleScan& Scan, const FLODProfileApplyOptions& Options, FLODProfileApplyReport* OutReport)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_RebuildStale);
+	FLODProfileApplyReport LocalReport;
+	FLODProfileApplyReport& Report = OutReport ? *OutReport : LocalReport;
+	const double RunStartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogLODProfileTool, Log, TEXT("%s"), *Scan.ToString());
+	for (const FAssetData& AssetData : Scan.Unresolved)
+	{
+		FLODProfileAssetReport& Entry = Report.Assets[Report.AddAsset(AssetData.GetSoftObjectPath())];
+		Entry.Status = ELODProfileAssetStatus::Skipped;
+		Entry.Message = TEXT("Profile source missing");
+	}
+
+	// A stale stamp is reason enough to rebuild, even if the mesh's settings already match.
+	FLODProfileApplyOptions GroupOptions = Options;
+	GroupOptions.bWriteReport = false;
+	GroupOptions.bSkipUnchanged = false;
+
+	int32 Successes = 0;
+	for (const FLODProfileStaleGroup& Group : Scan.Groups)
+	{
+		UE_LOG(LogLODProfileTool, Log, TEXT("Rebuilding %d stale asset(s) with LOD profile '%s'."), Group.Assets.Num(), *Group.Source);
+		GroupOptions.ProfileSource = Group.Source;
+		GroupOptions.ProfileVersion = Group.Version;
+		Successes += ApplyProfileToAssets(Group.Profile, Group.Assets, GroupOptions, &Report);
 	}
+
+	Report.TotalSeconds = FPlatformTime::Seconds() - RunStartTime;
+	FinishReport(Options, TEXT("Stale"), Report);
 	return Successes;
 }
 
-bool FLODProfileApplicator::ApplyProfileToMesh(UStaticMesh* Mesh, const FLODProfile& Profile, bool bAutoSave)
+FLODProfileEstimate FLODProfileApplicator::EstimateProfile(const FLODProfile& Profile, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_EstimateProfile);
+	const FString ProfileHash = FLODProfileStamp::HashProfile(Profile);
+
+	FLODProfileEstimate Estimate;
+	Estimate.Meshes.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		Estimate.Meshes.Add(EstimateMesh(AssetData, &Profile, ProfileHash, Options));
+	}
+	return Estimate;
+}
+
+FLODProfileEstimate FLODProfileApplicator::EstimateProfileRules(const FLODProfileRuleSet& RuleSet, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_EstimateProfileRules);
+	TMap<FName, FString> HashByProfile;
+
+	FLODProfileEstimate Estimate;
+	Estimate.Meshes.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		const FName ProfileName = RuleSet.FindProfileName(AssetData);
+		const FLODProfile* Profile = RuleSet.FindProfile(ProfileName);
+		FString ProfileHash;
+		if (Profile)
+		{
+			if (const FString* CachedHash = HashByProfile.Find(ProfileName))
+			{
+				ProfileHash = *CachedHash;
+			}
+			else
+			{
+				ProfileHash = HashByProfile.Add(ProfileName, FLODProfileStamp::HashProfile(*Profile));
+			}
+		}
+
+		FLODProfileMeshEstimate& MeshEstimate = Estimate.Meshes.Add_GetRef(EstimateMesh(AssetData, Profile, ProfileHash, Options));
+		MeshEstimate.ProfileName = ProfileName;
+	}
+	return Estimate;
+}
+
+FLODProfileEstimate FLODProfileApplicator::EstimateStale(const FLODProfileStaleScan& Scan, const FLODProfileApplyOptions& Options)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_EstimateStale);
+	FLODProfileApplyOptions GroupOptions = Options;
+	GroupOptions.bSkipUnchanged = false;
+
+	FLODProfileEstimate Estimate;
+	Estimate.Meshes.Reserve(Scan.CountStale());
+	for (const FLODProfileStaleGroup& Group : Scan.Groups)
+	{
+		const FString ProfileHash = FLODProfileStamp::HashProfile(Group.Profile);
+		const FName ProfileName(*Group.Source);
+		for (const FAssetData& AssetData : Group.Assets)
+		{
+			FLODProfileMeshEstimate& MeshEstimate = Estimate.Meshes.Add_GetRef(EstimateMesh(AssetData, &Group.Profile, ProfileHash, GroupOptions));
+			MeshEstimate.ProfileName = ProfileName;
+		}
+	}
+	return Estimate;
+}
+
+FLODProfileMeshEstimate FLODProfileApplicator::EstimateMesh(const FAssetData& AssetData, const FLODProfile* Profile, const FString& ProfileHash, const FLODProfileApplyOptions& Options)
+{
+	FLODProfileMeshEstimate Estimate;
+	Estimate.AssetPath = AssetData.GetSoftObjectPath();
+
+	// Only the tags are needed here; a default profile classifies the mesh when no rule picked one.
+	const FLODProfileAssetInfo Info = FLODProfileAssetFilter::Evaluate(AssetData, Profile ? *Profile : FLODProfile(), ProfileHash, Options);
+	if (Info.FilterResult == ELODProfileFilterResult::NotAMesh)
+	{
+		Estimate.Message = LexToString(Info.FilterResult);
+		return Estimate;
+	}
+
+	int32 NumVertices = 0;
+	int32 NumUVChannels = 1;
+	AssetData.GetTagValue(VerticesTag, NumVertices);
+	AssetData.GetTagValue(UVChannelsTag, NumUVChannels);
+	Estimate.bNaniteEnabled = Info.bNaniteEnabled;
+
+	const int64 SourceTriangles = FMath::Max(0, Info.NumTriangles);
+	const int32 CurrentLODCount = FMath::Max(1, Info.NumLODs);
+	const double VerticesPerTriangle = SourceTriangles > 0 ? double(NumVertices) / SourceTriangles : 0.0;
+	auto LODBytes = [&](int64 NumTriangles)
+	{
+		return EstimateLODBytes(NumTriangles, int64(NumTriangles * VerticesPerTriangle), NumUVChannels);
+	};
+
+	for (int32 LODIndex = 0; LODIndex < CurrentLODCount; ++LODIndex)
+	{
+		const int64 Triangles = SourceTriangles >> LODIndex;
+		Estimate.TrianglesBefore.Add(Triangles);
+		Estimate.BytesBefore += LODBytes(Triangles);
+	}
+
+	// Nanite meshes only get new fallback settings; their LOD chain stays as it is.
+	const bool bNaniteSettingsOnly = Profile && Info.bNaniteEnabled && Profile->Nanite.bApplyToNaniteMeshes;
+	if (!Profile || Info.FilterResult != ELODProfileFilterResult::Process || bNaniteSettingsOnly)
+	{
+		const bool bNaniteOnlyToProcess = bNaniteSettingsOnly && Info.FilterResult == ELODProfileFilterResult::Process;
+		Estimate.bWillChange = bNaniteOnlyToProcess && Profile->Nanite.HasOverrides();
+		Estimate.Message = !Profile ? FString(TEXT("No matching rule"))
+			: Estimate.bWillChange ? FString(TEXT("Nanite enabled: only fallback settings change"))
+			: bNaniteOnlyToProcess ? FString(TEXT("Nanite enabled: no Nanite setting overridden"))
+			: FString(LexToString(Info.FilterResult));
+		Estimate.TrianglesAfter = Estimate.TrianglesBefore;
+		Estimate.BytesAfter = Estimate.BytesBefore;
+		return Estimate;
+	}
+
+	Estimate.bWillChange = true;
+	const int32 TargetLODCount = GetTargetLODCount(*Profile, CurrentLODCount);
+	for (int32 LODIndex = 0; LODIndex < TargetLODCount; ++LODIndex)
+	{
+		int64 Triangles = SourceTriangles;
+		if (!Profile->bOverrideExisting && LODIndex < CurrentLODCount)
+		{
+			Triangles = Estimate.TrianglesBefore[LODIndex];
+		}
+		else if (Profile->bEnableReduction)
+		{
+			Triangles = int64(SourceTriangles * ResolveReductionPercent(*Profile, LODIndex, int32(SourceTriangles)) / 100.0f);
+		}
+		Estimate.TrianglesAfter.Add(Triangles);
+		Estimate.BytesAfter += LODBytes(Triangles);
+	}
+
+	if (Estimate.bNaniteEnabled)
+	{
+		Estimate.Message = TEXT("Nanite enabled: LODs only serve the fallback mesh");
+	}
+	return Estimate;
+}
+
+int32 FLODProfileApplicator::ApplyProfileToPaths(const FLODProfile& Profile, const TArray<FString>& PackagePaths, bool bRecursive, const FLODProfileApplyOptions& Options, FLODProfileApplyReport* OutReport)
 {
+	TArray<FAssetData> Assets;
+	GatherAssets(PackagePaths, { UStaticMesh::StaticClass()->GetClassPathName(), USkeletalMesh::StaticClass()->GetClassPathName() }, bRecursive, Assets);
+	UE_LOG(LogLODProfileTool, Log, TEXT("Found %d mesh(es) under %s."), Assets.Num(), *FString::Join(PackagePaths, TEXT(", ")));
+	return ApplyProfileToAssets(Profile, Assets, Options, OutReport);
+}
+
+void FLODProfileApplicator::GatherAssets(const TArray<FString>& PackagePaths, const TArray<FTopLevelAssetPath>& ClassPaths, bool bRecursive, TArray<FAssetData>& OutAssets)
+{
+	FARFilter Filter;
+	Filter.bRecursivePaths = bRecursive;
+	Filter.bRecursiveClasses = true;
+	Filter.ClassPaths = ClassPaths;
+	for (const FString& Path : PackagePaths)
+	{
+		Filter.PackagePaths.Add(FName(*Path));
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		AssetRegistry.ScanPathsSynchronous(PackagePaths, /*bForceRescan=*/false);
+	}
+	AssetRegistry.GetAssets(Filter, OutAssets);
+
+	// Sort for stable ordering across runs and machines.
+	OutAssets.Sort([](const FAssetData& A, const FAssetData& B)
+	{
+		return A.PackageName.LexicalLess(B.PackageName);
+	});
+}
+
+bool FLODProfileApplicator::ApplyProfileToMesh(UStaticMesh* Mesh, const FLODProfile& Profile, const FString& ProfileHash, FLODProfileAssetReport& OutEntry)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_ApplyProfileToMesh);
 	if (!Mesh)
 	{
 		return false;
 	}
 
+	OutEntry.TrianglesBefore = GetLODTriangleCounts(Mesh);
+
+	const double EditStartTime = FPlatformTime::Seconds();
+	{
+		SCOPE_CYCLE_COUNTER(STAT_LODProfile_Configure);
+		Mesh->Modify();
+		ConfigureMesh(Mesh, Profile);
+		FLODProfileStamp::Write(Mesh, ProfileHash);
+	}
+	const double BuildStartTime = FPlatformTime::Seconds();
+	OutEntry.EditMs = (BuildStartTime - EditStartTime) * MillisecondsPerSecond;
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_Build);
+		Mesh->Build(false);
+	}
+	OutEntry.BuildMs = (FPlatformTime::Seconds() - BuildStartTime) * MillisecondsPerSecond;
+	OutEntry.TrianglesAfter = GetLODTriangleCounts(Mesh);
+
+	if (Profile.bDeriveScreenSizesFromError && !UsesNaniteSettings(Mesh, Profile))
+	{
+		DeriveScreenSizesFromError(Mesh, Profile);
+		FLODProfileStamp::Write(Mesh, ProfileHash);
+	}
+
+	Mesh->MarkPackageDirty();
+	return true;
+}
+
+bool FLODProfileApplicator::IsMeshUpToDate(const UObject* Asset, const FLODProfile& Profile, const FString& ProfileHash)
+{
+	if (const USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Asset))
+	{
+		return FLODProfileStamp::IsUpToDate(SkeletalMesh, ProfileHash);
+	}
+	const UStaticMesh* Mesh = Cast<UStaticMesh>(Asset);
+	return Mesh && (FLODProfileStamp::IsUpToDate(Mesh, ProfileHash) || MeshMatchesProfile(Mesh, Profile));
+}
+
+void FLODProfileApplicator::BeginMeshApply(UStaticMesh* Mesh, const FLODProfile& Profile, const FString& ProfileHash, const FLODProfileApplyOptions& Options, FLODProfileAssetReport& OutEntry)
+{
+	OutEntry.TrianglesBefore = GetLODTriangleCounts(Mesh);
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_ConfigureSourceModels);
+	SCOPE_CYCLE_COUNTER(STAT_LODProfile_Configure);
+	const double EditStartTime = FPlatformTime::Seconds();
 	Mesh->Modify();
+	ConfigureMesh(Mesh, Profile);
+	FLODProfileStamp::Write(Mesh, ProfileHash);
+	FLODProfileStamp::WriteSource(Mesh, Options.ProfileSource, Options.ProfileVersion);
+	const double EditSeconds = FPlatformTime::Seconds() - EditStartTime;
+	OutEntry.EditMs = EditSeconds * MillisecondsPerSecond;
+	OutEntry.Seconds += EditSeconds;
+}
+
+void FLODProfileApplicator::FinishMeshApply(UStaticMesh* Mesh, const FLODProfile& Profile, const FString& ProfileHash, FLODProfileAssetReport& OutEntry)
+{
+	OutEntry.TrianglesAfter = GetLODTriangleCounts(Mesh);
+	if (Profile.bDeriveScreenSizesFromError && !UsesNaniteSettings(Mesh, Profile))
+	{
+		DeriveScreenSizesFromError(Mesh, Profile);
+		FLODProfileStamp::Write(Mesh, ProfileHash);
+	}
+}
+
+bool FLODProfileApplicator::PrepareMeshForBuild(UStaticMesh* Mesh, const FLODProfile& Profile, const FString& ProfileSource, int32 ProfileVersion)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_PrepareMeshForBuild);
+	if (!Mesh)
+	{
+		return false;
+	}
+
+	ConfigureMesh(Mesh, Profile);
+	const bool bStamped = !Profile.bDeriveScreenSizesFromError || UsesNaniteSettings(Mesh, Profile);
+	if (bStamped)
+	{
+		FLODProfileStamp::Write(Mesh, FLODProfileStamp::HashProfile(Profile));
+	}
+	FLODProfileStamp::WriteSource(Mesh, ProfileSource, ProfileVersion);
+	return bStamped;
+}
 
+int32 FLODProfileApplicator::GetTargetLODCount(const FLODProfile& Profile, int32 ExistingLODCount)
+{
+	return Profile.bOverrideExisting ? Profile.NumLODs : FMath::Max(ExistingLODCount, Profile.NumLODs);
+}
+
+bool FLODProfileApplicator::UsesNaniteSettings(const UStaticMesh* Mesh, const FLODProfile& Profile)
+{
+	return Profile.Nanite.bApplyToNaniteMeshes && Mesh->IsNaniteEnabled();
+}
+
+void FLODProfileApplicator::ConfigureMesh(UStaticMesh* Mesh, const FLODProfile& Profile)
+{
+	if (UsesNaniteSettings(Mesh, Profile))
+	{
+		ConfigureNaniteSettings(Mesh, Profile.Nanite);
+	}
+	else
+	{
+		ConfigureSourceModels(Mesh, Profile);
+	}
+}
+
+bool FLODProfileApplicator::MeshMatchesProfile(const UStaticMesh* Mesh, const FLODProfile& Profile)
+{
+	return UsesNaniteSettings(Mesh, Profile) ? NaniteSettingsMatchProfile(Mesh, Profile.Nanite) : SourceModelsMatchProfile(Mesh, Profile);
+}
+
+bool FLODProfileApplicator::NaniteSettingsMatchProfile(const UStaticMesh* Mesh, const FLODProfileNaniteSettings& Nanite)
+{
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+	const FMeshNaniteSettings& MeshSettings = Mesh->NaniteSettings;
+#else
+	const FMeshNaniteSettings& MeshSettings = Mesh->GetNaniteSettings();
+#endif
+	return (!Nanite.bOverride_FallbackTarget || MeshSettings.FallbackTarget == Nanite.FallbackTarget)
+		&& (!Nanite.bOverride_FallbackPercentTriangles || FMath::IsNearlyEqual(MeshSettings.FallbackPercentTriangles, Nanite.FallbackPercentTriangles))
+		&& (!Nanite.bOverride_FallbackRelativeError || FMath::IsNearlyEqual(MeshSettings.FallbackRelativeError, Nanite.FallbackRelativeError))
+		&& (!Nanite.bOverride_KeepPercentTriangles || FMath::IsNearlyEqual(MeshSettings.KeepPercentTriangles, Nanite.KeepPercentTriangles))
+		&& (!Nanite.bOverride_TrimRelativeError || FMath::IsNearlyEqual(MeshSettings.TrimRelativeError, Nanite.TrimRelativeError));
+}
+
+void FLODProfileApplicator::ConfigureNaniteSettings(UStaticMesh* Mesh, const FLODProfileNaniteSettings& Nanite)
+{
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+	FMeshNaniteSettings MeshSettings = Mesh->NaniteSettings;
+#else
+	FMeshNaniteSettings MeshSettings = Mesh->GetNaniteSettings();
+#endif
+	// Values without an override may have been tuned by hand on the mesh.
+	if (Nanite.bOverride_FallbackTarget)
+	{
+		MeshSettings.FallbackTarget = Nanite.FallbackTarget;
+	}
+	if (Nanite.bOverride_FallbackPercentTriangles)
+	{
+		MeshSettings.FallbackPercentTriangles = Nanite.FallbackPercentTriangles;
+	}
+	if (Nanite.bOverride_FallbackRelativeError)
+	{
+		MeshSettings.FallbackRelativeError = Nanite.FallbackRelativeError;
+	}
+	if (Nanite.bOverride_KeepPercentTriangles)
+	{
+		MeshSettings.KeepPercentTriangles = Nanite.KeepPercentTriangles;
+	}
+	if (Nanite.bOverride_TrimRelativeError)
+	{
+		MeshSettings.TrimRelativeError = Nanite.TrimRelativeError;
+	}
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+	Mesh->NaniteSettings = MeshSettings;
+#else
+	Mesh->SetNaniteSettings(MeshSettings);
+#endif
+}
+
+bool FLODProfileApplicator::SourceModelsMatchProfile(const UStaticMesh* Mesh, const FLODProfile& Profile)
+{
+	const int32 ExistingLODCount = Mesh->GetNumSourceModels();
+	if (Mesh->bAutoComputeLODScreenSize || GetTargetLODCount(Profile, ExistingLODCount) != ExistingLODCount)
+	{
+		return false;
+	}
+
+	// Without overrides the per-platform values are left alone, so hand-authored ones do not make a mesh stale.
+	if (FLODProfilePlatforms::HasOverrides(Profile) && !FLODProfilePlatforms::MinLODMatches(Mesh, Profile))
+	{
+		return false;
+	}
+
+	if (!Profile.bOverrideExisting)
+	{
+		// Every existing LOD is preserved and none would be added.
+		return true;
+	}
+
+	const int32 SourceTriangles = GetSourceTriangleCount(Mesh, Profile);
+	for (int32 LODIndex = 0; LODIndex < ExistingLODCount; ++LODIndex)
+	{
+		// Stripped sections live in the LOD's own geometry, which only the stamp can vouch for. A stripped copy the
+		// profile no longer asks for has to be reset.
+		const bool bStripsSections = LODIndex > 0 && Profile.LODSections.IsValidIndex(LODIndex) && Profile.LODSections[LODIndex].HasWork();
+		if (bStripsSections || FLODProfileSections::IsApplied(Mesh, LODIndex))
+		{
+			return false;
+		}
+
+		// Derived screen sizes depend on the build result, so only the stamp can tell whether they are current.
+		const bool bScreenSizeDerived = Profile.bDeriveScreenSizesFromError && LODIndex > 0;
+		const FStaticMeshSourceModel& SourceModel = Mesh->GetSourceModel(LODIndex);
+		if (!bScreenSizeDerived && !FMath::IsNearlyEqual(SourceModel.ScreenSize.Default, GetScreenSize(Profile, LODIndex)))
+		{
+			return false;
+		}
+		if (!FLODProfilePlatforms::ScreenSizeMatches(Profile, LODIndex, SourceModel.ScreenSize))
+		{
+			return false;
+		}
+
+		if (Profile.bEnableReduction)
+		{
+			const float Percent = ResolveReductionPercent(Profile, LODIndex, SourceTriangles);
+			if (!FMath::IsNearlyEqual(SourceModel.ReductionSettings.PercentTriangles, Percent / 100.0f))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void FLODProfileApplicator::ConfigureSourceModels(UStaticMesh* Mesh, const FLODProfile& Profile)
+{
 	const int32 ExistingLODCount = Mesh->GetNumSourceModels();
-	const int32 TargetLODCount = Profile.bOverrideExisting ? Profile.NumLODs : FMath::Max(ExistingLODCount, Profile.NumLODs);
+	const int32 TargetLODCount = GetTargetLODCount(Profile, ExistingLODCount);
+	const int32 SourceTriangles = GetSourceTriangleCount(Mesh, Profile);
 	Mesh->SetNumSourceModels(TargetLODCount);
 	Mesh->bAutoComputeLODScreenSize = false;
 
@@ -133,44 +1179,152 @@ bool FLODProfileApplicator::ApplyProfileToMesh(UStaticMesh* Mesh, const FLODProf
 
 		if (Profile.bOverrideExisting || LODIndex >= ExistingLODCount)
 		{
-			SourceModel.ScreenSize.Default = GetScreenSize(Profile, LODIndex);
+			FLODProfilePlatforms::ConfigureScreenSize(Profile, LODIndex, SourceModel.ScreenSize);
 
 			if (Profile.bEnableReduction)
 			{
-				const float Percent = FMath::Clamp(GetReductionPercent(Profile, LODIndex), 0.0f, 100.0f);
+				const float Percent = ResolveReductionPercent(Profile, LODIndex, SourceTriangles);
 				SourceModel.ReductionSettings.PercentTriangles = Percent / 100.0f;
 			}
+
+			// A LOD the profile no longer strips goes back to reducing from LOD0.
+			const bool bStripped = LODIndex > 0 && Profile.LODSections.IsValidIndex(LODIndex) && Profile.LODSections[LODIndex].HasWork()
+				&& FLODProfileSections::Apply(Mesh, LODIndex, Profile.LODSections[LODIndex]);
+			if (!bStripped)
+			{
+				FLODProfileSections::Reset(Mesh, LODIndex);
+			}
 		}
 	}
 
-	Mesh->Build(false);
-	Mesh->MarkPackageDirty();
+	// Only profiles with overrides touch minimum LODs, so hand-authored per-platform values survive the default profile.
+	if (FLODProfilePlatforms::HasOverrides(Profile))
+	{
+		FLODProfilePlatforms::ConfigureMinLOD(Mesh, Profile);
+	}
+}
 
-	if (bAutoSave)
+void FLODProfileApplicator::DeriveScreenSizesFromError(UStaticMesh* Mesh, const FLODProfile& Profile)
+{
+	FStaticMeshRenderData* RenderData = Mesh->GetRenderData();
+	if (!RenderData || RenderData->LODResources.Num() != Mesh->GetNumSourceModels())
 	{
-		SaveMesh(Mesh);
+		return;
 	}
 
-	return true;
+	// A deviation of D world units on a mesh of radius R spans D * ScreenSize * ScreenHeight / (2R) pixels once the
+	// mesh covers ScreenSize of the screen, so the LOD may be used below ScreenSize = 2R * MaxPixelError / (D * ScreenHeight).
+	const float Diameter = 2.0f * RenderData->Bounds.SphereRadius;
+	float PreviousScreenSize = Mesh->GetSourceModel(0).ScreenSize.Default;
+
+	for (int32 LODIndex = 1; LODIndex < RenderData->LODResources.Num(); ++LODIndex)
+	{
+		FStaticMeshSourceModel& SourceModel = Mesh->GetSourceModel(LODIndex);
+		if (!Mesh->IsReductionActive(LODIndex))
+		{
+			PreviousScreenSize = SourceModel.ScreenSize.Default;
+			continue;
+		}
+
+		// Without a measurable deviation there is no error bound; keep the profile's screen size rather than one of 0,
+		// which would also drag every later LOD down to 0.
+		const float Deviation = RenderData->LODResources[LODIndex].MaxDeviation;
+		const float ErrorBoundSize = Deviation > UE_KINDA_SMALL_NUMBER
+			? Diameter * Profile.MaxPixelError / (Deviation * Profile.ReferenceScreenHeight)
+			: SourceModel.ScreenSize.Default;
+
+		// Keep the thresholds descending so every earlier LOD stays reachable.
+		const float ScreenSize = FMath::Clamp(ErrorBoundSize, 0.0f, PreviousScreenSize);
+		SourceModel.ScreenSize.Default = ScreenSize;
+		RenderData->ScreenSize[LODIndex].Default = ScreenSize;
+		PreviousScreenSize = ScreenSize;
+	}
 }
 
-bool FLODProfileApplicator::SaveMesh(UStaticMesh* Mesh)
+void FLODProfileApplicator::BuildMeshes(const TArray<UStaticMesh*>& Meshes, int32 MaxConcurrentBuilds, TFunctionRef<void(UStaticMesh*)> PrepareMesh, TFunctionRef<void(UStaticMesh*, double)> OnMeshBuilt, TFunctionRef<bool()> ShouldCancel)
 {
-	if (!Mesh)
+	const int32 MaxInFlight = MaxConcurrentBuilds > 0
+		? MaxConcurrentBuilds
+		: FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+
+	FStaticMeshCompilingManager& CompilingManager = FStaticMeshCompilingManager::Get();
+	TArray<UStaticMesh*> InFlight;
+	InFlight.Reserve(MaxInFlight);
+	TMap<UStaticMesh*, double> LaunchTimes;
+	int32 NextIndex = 0;
+
+	while (NextIndex < Meshes.Num() || InFlight.Num() > 0)
 	{
-		return false;
+		// Once cancelled, stop launching and drain the builds already in flight.
+		if (NextIndex < Meshes.Num() && ShouldCancel())
+		{
+			NextIndex = Meshes.Num();
+		}
+
+		// Top up the in-flight set. When async compilation is disabled BatchBuild completes synchronously.
+		TArray<UStaticMesh*> ToLaunch;
+		while (InFlight.Num() + ToLaunch.Num() < MaxInFlight && NextIndex < Meshes.Num())
+		{
+			UStaticMesh* Mesh = Meshes[NextIndex++];
+			PrepareMesh(Mesh);
+			ToLaunch.Add(Mesh);
+		}
+		if (ToLaunch.Num() > 0)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_LaunchBuilds);
+			SCOPE_CYCLE_COUNTER(STAT_LODProfile_LaunchBuilds);
+			INC_DWORD_STAT_BY(STAT_LODProfile_BuildsInFlight, ToLaunch.Num());
+			UStaticMesh::FBuildParameters BuildParameters;
+			BuildParameters.bInSilent = true;
+			const double LaunchTime = FPlatformTime::Seconds();
+			for (UStaticMesh* Mesh : ToLaunch)
+			{
+				LaunchTimes.Add(Mesh, LaunchTime);
+			}
+			UStaticMesh::BatchBuild(ToLaunch, BuildParameters);
+			InFlight.Append(ToLaunch);
+		}
+
+		// Finished builds are only finalized on the game thread by the compiling manager.
+		CompilingManager.ProcessAsyncTasks();
+
+		bool bAnyFinished = false;
+		for (int32 Index = InFlight.Num() - 1; Index >= 0; --Index)
+		{
+			UStaticMesh* Mesh = InFlight[Index];
+			if (!Mesh->IsCompiling())
+			{
+				InFlight.RemoveAtSwap(Index);
+				DEC_DWORD_STAT(STAT_LODProfile_BuildsInFlight);
+				OnMeshBuilt(Mesh, FPlatformTime::Seconds() - LaunchTimes.FindChecked(Mesh));
+				bAnyFinished = true;
+			}
+		}
+
+		if (!bAnyFinished && InFlight.Num() > 0)
+		{
+			FPlatformProcess::Sleep(0.005f);
+		}
+	}
+}
+
+void FLODProfileApplicator::ReleasePackages(const TArray<UPackage*>& Packages)
+{
+	if (Packages.Num() == 0)
+	{
+		return;
 	}
 
-	UPackage* Package = Mesh->GetOutermost();
-	TArray<UPackage*> PackagesToSave;
-	PackagesToSave.Add(Package);
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_CollectGarbage);
+	SCOPE_CYCLE_COUNTER(STAT_LODProfile_CollectGarbage);
 
-	const bool bSuccess = FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, /*bCheckDirty=*/false, /*bPromptToSave=*/false) != EAppReturnType::Cancel;
-	if (!bSuccess)
+	// Assets loaded in the editor are RF_Standalone, so a plain garbage collection keeps them resident. Unloading
+	// clears the flag, resets their loaders and collects them. Dirty packages hold unsaved edits and are kept.
+	FText ErrorMessage;
+	if (!UPackageTools::UnloadPackages(Packages, ErrorMessage, /*bUnloadDirtyPackages=*/false) && !ErrorMessage.IsEmpty())
 	{
-		UE_LOG(LogLODProfileTool, Warning, TEXT("Failed to save package %s"), *Package->GetName());
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Could not release every package of the window: %s"), *ErrorMessage.ToString());
 	}
-	return bSuccess;
 }
 
 void FLODProfileApplicator::OpenPreviewForAssets(const TArray<FAssetData>& Assets)
@@ -6,7 +6,15 @@
 #include "AssetRegistry/AssetData.h"
 #include "LODProfileTypes.h"
 
+class UPackage;
 class UStaticMesh;
+struct FLODProfileApplyReport;
+struct FLODProfileEstimate;
+struct FLODProfileMeshEstimate;
+struct FLODProfileAssetReport;
+struct FLODProfileJobJournal;
+struct FLODProfileStaleScan;
+class FLODProfileRuleSet;
 
 /**
  * Stateless helper that applies LOD profiles to static meshes.
@@ -14,8 +22,64 @@ class UStaticMesh;
 class FLODProfileApplicator
 {
 public:
-	/** Applies the profile to the provided assets. Returns number of successes. */
-	static int32 ApplyProfileToAssets(const FLODProfile& Profile, const TArray<FAssetData>& Assets, bool bAutoSave);
+	/**
+	 * Applies the profile to the provided assets. Returns number of successes. Per-asset results go to OutReport when provided.
+	 * Runs are cancellable from the progress dialog; with auto-save they are journaled so they can be resumed.
+	 */
+	static int32 ApplyProfileToAssets(const FLODProfile& Profile, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options, FLODProfileApplyReport* OutReport = nullptr);
+
+	/** Continues a cancelled or interrupted job with its stored profile and options. */
+	static int32 ResumeJob(FLODProfileJobJournal& Journal, FLODProfileApplyReport* OutReport = nullptr);
+
+	/** Applies the profile to every static mesh under the given content paths, discovered through the asset registry. */
+	static int32 ApplyProfileToPaths(const FLODProfile& Profile, const TArray<FString>& PackagePaths, bool bRecursive, const FLODProfileApplyOptions& Options, FLODProfileApplyReport* OutReport = nullptr);
+
+	/** Resolves each asset's profile through the rule set in one registry-only pass, then applies each profile to its group. */
+	static int32 ApplyProfileRules(const FLODProfileRuleSet& RuleSet, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options, FLODProfileApplyReport* OutReport = nullptr);
+
+	/**
+	 * Rebuilds the stale meshes of a scan, each group with the current state of the profile that built it. Meshes are
+	 * rebuilt even when their LOD settings happen to match, so the stamp catches up with the profile.
+	 */
+	static int32 RebuildStale(const FLODProfileStaleScan& Scan, const FLODProfileApplyOptions& Options, FLODProfileApplyReport* OutReport = nullptr);
+
+	/**
+	 * Dry run: predicts triangles per LOD and vertex/index buffer bytes before and after applying the profile, from asset
+	 * registry tags only. Nothing is loaded, edited or built.
+	 */
+	static FLODProfileEstimate EstimateProfile(const FLODProfile& Profile, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options);
+
+	/** Dry run of ApplyProfileRules. */
+	static FLODProfileEstimate EstimateProfileRules(const FLODProfileRuleSet& RuleSet, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options);
+
+	/** Dry run of RebuildStale. */
+	static FLODProfileEstimate EstimateStale(const FLODProfileStaleScan& Scan, const FLODProfileApplyOptions& Options);
+
+	/** Queries the asset registry for assets of the given classes under the paths, without loading them. Sorted by package name. */
+	static void GatherAssets(const TArray<FString>& PackagePaths, const TArray<FTopLevelAssetPath>& ClassPaths, bool bRecursive, TArray<FAssetData>& OutAssets);
+
+	/**
+	 * Configures source models (or Nanite settings) and stamps the mesh without building it, for meshes whose first build is still to come,
+	 * such as during import. Meshes using derived screen sizes are left unstamped so a later apply derives them.
+	 * ProfileSource and ProfileVersion identify the library asset or named profile for later stale rebuilds.
+	 * Returns whether the mesh was stamped, i.e. needs no apply after its build.
+	 */
+	static bool PrepareMeshForBuild(UStaticMesh* Mesh, const FLODProfile& Profile, const FString& ProfileSource = FString(), int32 ProfileVersion = 0);
+
+	/** True when a loaded static or skeletal mesh needs no work: stamped with ProfileHash, or already matching the profile. */
+	static bool IsMeshUpToDate(const UObject* Asset, const FLODProfile& Profile, const FString& ProfileHash);
+
+	/** Edits a loaded static mesh for the profile and stamps it. The caller launches the build. Records edit time and triangles before into OutEntry. */
+	static void BeginMeshApply(UStaticMesh* Mesh, const FLODProfile& Profile, const FString& ProfileHash, const FLODProfileApplyOptions& Options, FLODProfileAssetReport& OutEntry);
+
+	/** Completes a static mesh whose build finished: derives screen sizes when the profile asks for it and records the built triangles. */
+	static void FinishMeshApply(UStaticMesh* Mesh, const FLODProfile& Profile, const FString& ProfileHash, FLODProfileAssetReport& OutEntry);
+
+	/** Logs the run summary and writes the CSV/JSON report when the options ask for it. */
+	static void FinishReport(const FLODProfileApplyOptions& Options, const FString& RunName, FLODProfileApplyReport& Report);
+
+	/** Unloads the packages of a processed window so their meshes are actually freed. Dirty packages are kept. */
+	static void ReleasePackages(const TArray<UPackage*>& Packages);
 
 	/** Opens the editor for the first selected static mesh, if any. */
 	static void OpenPreviewForAssets(const TArray<FAssetData>& Assets);
@@ -23,7 +87,57 @@ public:
 	/** Validates the profile and returns an error string if invalid. */
 	static bool ValidateProfile(const FLODProfile& Profile, FString& OutError);
 
+	/** Screen size of the LOD in the profile, with decreasing fallbacks past the end of ScreenSizes. */
+	static float GetScreenSize(const FLODProfile& Profile, int32 LODIndex);
+
+	/** Percentage of LOD0 triangles the LOD keeps on a mesh, resolving budgets and densities from its triangle count. */
+	static float ResolveReductionPercent(const FLODProfile& Profile, int32 LODIndex, int32 SourceTriangles);
+
 private:
-	static bool ApplyProfileToMesh(UStaticMesh* Mesh, const FLODProfile& Profile, bool bAutoSave);
-	static bool SaveMesh(UStaticMesh* Mesh);
+	/** Processes the assets of a job in windows, keeping the journal up to date. */
+	static int32 RunJob(FLODProfileJobJournal& Journal, const TArray<FAssetData>& AssetsToProcess, FLODProfileApplyReport& Report);
+
+	/** Edits and builds a single mesh on the game thread, recording stage timings into OutEntry. */
+	static bool ApplyProfileToMesh(UStaticMesh* Mesh, const FLODProfile& Profile, const FString& ProfileHash, FLODProfileAssetReport& OutEntry);
+
+	/** Estimates one mesh. A null profile means it would not be touched. */
+	static FLODProfileMeshEstimate EstimateMesh(const FAssetData& AssetData, const FLODProfile* Profile, const FString& ProfileHash, const FLODProfileApplyOptions& Options);
+
+	/** True when the mesh is Nanite-enabled and the profile routes such meshes to its Nanite section. */
+	static bool UsesNaniteSettings(const UStaticMesh* Mesh, const FLODProfile& Profile);
+
+	/** Writes the profile into the mesh without building: Nanite settings or source models, whichever applies. */
+	static void ConfigureMesh(UStaticMesh* Mesh, const FLODProfile& Profile);
+
+	/** True when ConfigureMesh would not change anything on the mesh. */
+	static bool MeshMatchesProfile(const UStaticMesh* Mesh, const FLODProfile& Profile);
+
+	/** Writes the profile's Nanite section into the mesh, leaving source models untouched. */
+	static void ConfigureNaniteSettings(UStaticMesh* Mesh, const FLODProfileNaniteSettings& Nanite);
+
+	/** True when ConfigureNaniteSettings would not change anything on the mesh. */
+	static bool NaniteSettingsMatchProfile(const UStaticMesh* Mesh, const FLODProfileNaniteSettings& Nanite);
+
+	/** Writes the profile into the mesh source models without building. */
+	static void ConfigureSourceModels(UStaticMesh* Mesh, const FLODProfile& Profile);
+
+	/** True when ConfigureSourceModels would not change anything on the mesh. */
+	static bool SourceModelsMatchProfile(const UStaticMesh* Mesh, const FLODProfile& Profile);
+
+	/**
+	 * Sets the screen size of every reduced LOD from the deviation the reduction measured against LOD0 and the profile's
+	 * pixel error budget. Runs after the build; the render data is updated in place so no second build is needed.
+	 */
+	static void DeriveScreenSizesFromError(UStaticMesh* Mesh, const FLODProfile& Profile);
+
+	/** Number of source models the mesh ends up with after applying the profile. */
+	static int32 GetTargetLODCount(const FLODProfile& Profile, int32 ExistingLODCount);
+
+	/**
+	 * Builds meshes through the batched build path, keeping at most MaxConcurrentBuilds in flight. PrepareMesh runs right
+	 * before a mesh launches; OnMeshBuilt reports it with its build latency in seconds. Once ShouldCancel returns true no
+	 * further meshes are prepared or launched, and the builds in flight are drained.
+	 */
+	static void BuildMeshes(const TArray<UStaticMesh*>& Meshes, int32 MaxConcurrentBuilds, TFunctionRef<void(UStaticMesh*)> PrepareMesh,
+		TFunctionRef<void(UStaticMesh*, double)> OnMeshBuilt, TFunctionRef<bool()> ShouldCancel);
 };
@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileAsset.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "LODProfileStamp.h"
+#include "LODProfileToolSettings.h"
+
+void ULODProfileAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	// Assets saved before the hash existed get one without a version bump.
+	if (ProfileHash.IsEmpty())
+	{
+		ProfileHash = FLODProfileStamp::HashProfile(GetSanitizedProfile());
+	}
+}
+
+void ULODProfileAsset::PreSave(FObjectPreSaveContext SaveContext)
+{
+	// Edits only count once they are saved, so a session of tweaks is one version. Cooking does not change the profile.
+	if (!SaveContext.IsProceduralSave())
+	{
+		UpdateVersion();
+	}
+	Super::PreSave(SaveContext);
+}
+
+FLODProfile ULODProfileAsset::GetSanitizedProfile() const
+{
+	FLODProfile Sanitized = Profile;
+	ULODProfileToolSettings::SanitizeProfile(Sanitized);
+	return Sanitized;
+}
+
+TArray<FAssetData> ULODProfileAsset::GatherLibrary()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByClass(ULODProfileAsset::StaticClass()->GetClassPathName(), Assets, /*bSearchSubClasses=*/true);
+	Assets.Sort([](const FAssetData& A, const FAssetData& B)
+	{
+		return A.AssetName.LexicalLess(B.AssetName);
+	});
+	return Assets;
+}
+
+void ULODProfileAsset::UpdateVersion()
+{
+	const FString NewHash = FLODProfileStamp::HashProfile(GetSanitizedProfile());
+	if (NewHash == ProfileHash)
+	{
+		return;
+	}
+
+	if (!ProfileHash.IsEmpty())
+	{
+		++Version;
+	}
+	ProfileHash = NewHash;
+}
@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileAssetFilter.h"
+
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "LODProfilePlatforms.h"
+#include "LODProfileStamp.h"
+
+const FName FLODProfileAssetFilter::LODsTag(TEXT("LODs"));
+const FName FLODProfileAssetFilter::TrianglesTag(TEXT("Triangles"));
+const FName FLODProfileAssetFilter::NaniteEnabledTag(TEXT("NaniteEnabled"));
+
+const TCHAR* LexToString(ELODProfileFilterResult Result)
+{
+	switch (Result)
+	{
+	case ELODProfileFilterResult::Process:                return TEXT("Process");
+	case ELODProfileFilterResult::NotAMesh:               return TEXT("Not a static or skeletal mesh");
+	case ELODProfileFilterResult::UpToDate:               return TEXT("Up to date");
+	case ELODProfileFilterResult::BelowTriangleThreshold: return TEXT("Below triangle threshold");
+	}
+	return TEXT("Unknown");
+}
+
+FString FLODProfileFilterSummary::ToString() const
+{
+	return FString::Printf(TEXT("%d selected: %d will be processed (%lld LOD0 triangles, %d Nanite), %d up to date, %d below triangle threshold, %d not meshes."),
+		NumAssets, NumToProcess, TrianglesToProcess, NumNaniteToProcess, NumUpToDate, NumBelowTriangleThreshold, NumNotMeshes);
+}
+
+bool FLODProfileAssetFilter::IsStampedAndUnedited(const FAssetData& AssetData, const FString& ProfileHash)
+{
+	// A mesh already in memory may have been edited or reimported since its tags were written, so its stamp is
+	// checked against its current source models, as the applicator does after loading.
+	if (const UObject* Object = AssetData.FastGetAsset(/*bLoad=*/false))
+	{
+		if (const UStaticMesh* Mesh = Cast<UStaticMesh>(Object))
+		{
+			return FLODProfileStamp::IsUpToDate(Mesh, ProfileHash);
+		}
+		if (const USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Object))
+		{
+			return FLODProfileStamp::IsUpToDate(SkeletalMesh, ProfileHash);
+		}
+	}
+	return FLODProfileStamp::IsStampedWith(AssetData, ProfileHash);
+}
+
+FLODProfileAssetInfo FLODProfileAssetFilter::Evaluate(const FAssetData& AssetData, const FLODProfile& Profile, const FString& ProfileHash, const FLODProfileApplyOptions& Options)
+{
+	FLODProfileAssetInfo Info;
+	Info.AssetData = AssetData;
+
+	if (!AssetData.IsInstanceOf(UStaticMesh::StaticClass()) && !AssetData.IsInstanceOf(USkeletalMesh::StaticClass()))
+	{
+		Info.FilterResult = ELODProfileFilterResult::NotAMesh;
+		return Info;
+	}
+
+	AssetData.GetTagValue(LODsTag, Info.NumLODs);
+	AssetData.GetTagValue(TrianglesTag, Info.NumTriangles);
+	AssetData.GetTagValue(NaniteEnabledTag, Info.bNaniteEnabled);
+
+	if (Options.bSkipUnchanged)
+	{
+		// Without override, meshes that already have enough LODs keep all of them untouched, unless the profile has
+		// per-platform or quality-level minimum LODs to write, which the tags cannot confirm. Nanite meshes routed to the
+		// Nanite section never get LODs added, so the LOD count says nothing about them.
+		const bool bNaniteSettingsOnly = Info.bNaniteEnabled && Profile.Nanite.bApplyToNaniteMeshes;
+		const bool bNothingToAdd = !bNaniteSettingsOnly && !Profile.bOverrideExisting && !FLODProfilePlatforms::HasOverrides(Profile)
+			&& Info.NumLODs >= Profile.NumLODs;
+		if (bNothingToAdd || IsStampedAndUnedited(AssetData, ProfileHash))
+		{
+			Info.FilterResult = ELODProfileFilterResult::UpToDate;
+			return Info;
+		}
+	}
+
+	if (Options.MinTrianglesToProcess > 0 && Info.NumTriangles != INDEX_NONE && Info.NumTriangles < Options.MinTrianglesToProcess)
+	{
+		Info.FilterResult = ELODProfileFilterResult::BelowTriangleThreshold;
+	}
+	return Info;
+}
+
+TArray<FLODProfileAssetInfo> FLODProfileAssetFilter::EvaluateAll(const TArray<FAssetData>& Assets, const FLODProfile& Profile, const FLODProfileApplyOptions& Options)
+{
+	const FString ProfileHash = FLODProfileStamp::HashProfile(Profile);
+
+	TArray<FLODProfileAssetInfo> Infos;
+	Infos.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		Infos.Add(Evaluate(AssetData, Profile, ProfileHash, Options));
+	}
+	return Infos;
+}
+
+FLODProfileFilterSummary FLODProfileAssetFilter::Summarize(const TArray<FLODProfileAssetInfo>& Infos)
+{
+	FLODProfileFilterSummary Summary;
+	Summary.NumAssets = Infos.Num();
+	for (const FLODProfileAssetInfo& Info : Infos)
+	{
+		switch (Info.FilterResult)
+		{
+		case ELODProfileFilterResult::Process:
+			++Summary.NumToProcess;
+			Summary.NumNaniteToProcess += Info.bNaniteEnabled ? 1 : 0;
+			Summary.TrianglesToProcess += FMath::Max(0, Info.NumTriangles);
+			break;
+		case ELODProfileFilterResult::NotAMesh:
+			++Summary.NumNotMeshes;
+			break;
+		case ELODProfileFilterResult::UpToDate:
+			++Summary.NumUpToDate;
+			break;
+		case ELODProfileFilterResult::BelowTriangleThreshold:
+			++Summary.NumBelowTriangleThreshold;
+			break;
+		}
+	}
+	return Summary;
+}
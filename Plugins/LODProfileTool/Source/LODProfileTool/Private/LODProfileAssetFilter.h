@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "LODProfileTypes.h"
+
+/** Why the registry pre-pass kept or dropped an asset. */
+enum class ELODProfileFilterResult : uint8
+{
+	Process,
+	NotAMesh,
+	UpToDate,
+	BelowTriangleThreshold
+};
+
+const TCHAR* LexToString(ELODProfileFilterResult Result);
+
+/**
+ * Asset registry view of a mesh, read from tags without loading its package.
+ */
+struct FLODProfileAssetInfo
+{
+	FAssetData AssetData;
+
+	/** LOD count of the built render data, or INDEX_NONE when the tag is missing. */
+	int32 NumLODs = INDEX_NONE;
+
+	/** LOD0 triangle count, or INDEX_NONE when the tag is missing. */
+	int32 NumTriangles = INDEX_NONE;
+
+	bool bNaniteEnabled = false;
+
+	ELODProfileFilterResult FilterResult = ELODProfileFilterResult::Process;
+};
+
+/**
+ * Totals of a registry pre-pass, used for previews.
+ */
+struct FLODProfileFilterSummary
+{
+	int32 NumAssets = 0;
+	int32 NumNotMeshes = 0;
+	int32 NumUpToDate = 0;
+	int32 NumBelowTriangleThreshold = 0;
+	int32 NumToProcess = 0;
+	int32 NumNaniteToProcess = 0;
+	int64 TrianglesToProcess = 0;
+
+	/** Single-line description for logs and the tab. */
+	FString ToString() const;
+};
+
+/**
+ * Pre-pass that classifies assets purely from asset registry tags, so non-meshes and meshes that
+ * already comply with a profile are dropped before any package is loaded.
+ */
+class FLODProfileAssetFilter
+{
+public:
+	/** Asset registry tags written by UStaticMesh::GetAssetRegistryTags. */
+	static const FName LODsTag;
+	static const FName TrianglesTag;
+	static const FName NaniteEnabledTag;
+
+	/** Reads the registry tags of a single asset and classifies it against the profile. */
+	static FLODProfileAssetInfo Evaluate(const FAssetData& AssetData, const FLODProfile& Profile, const FString& ProfileHash, const FLODProfileApplyOptions& Options);
+
+	/** Classifies every asset. The result is parallel to Assets. */
+	static TArray<FLODProfileAssetInfo> EvaluateAll(const TArray<FAssetData>& Assets, const FLODProfile& Profile, const FLODProfileApplyOptions& Options);
+
+	static FLODProfileFilterSummary Summarize(const TArray<FLODProfileAssetInfo>& Infos);
+
+private:
+	/**
+	 * True when the mesh is stamped with ProfileHash. Meshes already loaded also need their source model hash to match,
+	 * so ones edited by hand or reimported in this session are not taken as up to date.
+	 */
+	static bool IsStampedAndUnedited(const FAssetData& AssetData, const FString& ProfileHash);
+};
@@ -0,0 +1,319 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileAudit.h"
+
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "LODProfileApplicator.h"
+#include "LODProfilePlatforms.h"
+#include "LODProfileReport.h"
+#include "LODProfileTool.h"
+#include "Misc/ScopedSlowTask.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "StaticMeshCompiler.h"
+#include "StaticMeshResources.h"
+#include "UObject/Package.h"
+
+#define LOCTEXT_NAMESPACE "LODProfileAudit"
+
+namespace
+{
+	int64 GetLODRenderBytes(const FStaticMeshLODResources& LODResources)
+	{
+		const FStaticMeshVertexBuffers& VertexBuffers = LODResources.VertexBuffers;
+		return int64(VertexBuffers.PositionVertexBuffer.GetStride()) * VertexBuffers.PositionVertexBuffer.GetNumVertices()
+			+ VertexBuffers.StaticMeshVertexBuffer.GetResourceSize()
+			+ VertexBuffers.ColorVertexBuffer.GetAllocatedSize()
+			+ LODResources.IndexBuffer.GetAllocatedSize();
+	}
+
+	/** Reads the built LOD chain and flags it. Only reads render data, so it may run on any thread once the mesh is compiled. */
+	void AnalyzeMesh(const UStaticMesh& Mesh, const FLODProfileAuditOptions& Options, FLODProfileAuditEntry& Entry)
+	{
+		const FStaticMeshRenderData* RenderData = Mesh.GetRenderData();
+		if (!RenderData)
+		{
+			return;
+		}
+
+		const int32 NumLODs = RenderData->LODResources.Num();
+		for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+		{
+			const FStaticMeshLODResources& LODResources = RenderData->LODResources[LODIndex];
+			Entry.Triangles.Add(LODResources.GetNumTriangles());
+			Entry.ScreenSizes.Add(RenderData->ScreenSize[LODIndex].Default);
+			Entry.RenderBytes += GetLODRenderBytes(LODResources);
+		}
+
+		if (NumLODs == 0)
+		{
+			return;
+		}
+
+		if (NumLODs == 1 && !Entry.bNaniteEnabled && Entry.Triangles[0] > Options.MissingLODsTriangleThreshold)
+		{
+			Entry.Issues |= ELODProfileAuditIssue::MissingLODs;
+		}
+
+		if (NumLODs > 1 && Entry.Triangles[1] < Options.MinLOD1Triangles && Entry.Triangles[0] >= 4 * Options.MinLOD1Triangles)
+		{
+			Entry.Issues |= ELODProfileAuditIssue::CollapsedLOD;
+		}
+
+		for (int32 LODIndex = 1; LODIndex < NumLODs; ++LODIndex)
+		{
+			const int32 Previous = Entry.Triangles[LODIndex - 1];
+			const int32 Current = Entry.Triangles[LODIndex];
+			if (Current > Previous * Options.MaxTriangleRatio)
+			{
+				Entry.Issues |= ELODProfileAuditIssue::NoReduction;
+			}
+			if (Entry.ScreenSizes[LODIndex] >= Entry.ScreenSizes[LODIndex - 1])
+			{
+				Entry.Issues |= ELODProfileAuditIssue::NonMonotonicScreenSize;
+			}
+			Entry.WastedTriangles += FMath::Max(0, Current - Previous / 2);
+		}
+
+		// Triangles drawn by an instance whose screen size is uniformly distributed over [0, 1]: each LOD contributes its
+		// triangle count over the screen size range it is selected for.
+		for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+		{
+			const float Upper = LODIndex == 0 ? 1.0f : FMath::Clamp(Entry.ScreenSizes[LODIndex], 0.0f, 1.0f);
+			const float Lower = LODIndex + 1 < NumLODs ? FMath::Clamp(Entry.ScreenSizes[LODIndex + 1], 0.0f, 1.0f) : 0.0f;
+			Entry.GpuCost += double(Entry.Triangles[LODIndex]) * FMath::Max(0.0f, Upper - Lower);
+		}
+	}
+}
+
+FString LexToString(ELODProfileAuditIssue Issues)
+{
+	TArray<FString> Names;
+	if (EnumHasAnyFlags(Issues, ELODProfileAuditIssue::NoReduction))
+	{
+		Names.Add(TEXT("NoReduction"));
+	}
+	if (EnumHasAnyFlags(Issues, ELODProfileAuditIssue::NonMonotonicScreenSize))
+	{
+		Names.Add(TEXT("NonMonotonicScreenSize"));
+	}
+	if (EnumHasAnyFlags(Issues, ELODProfileAuditIssue::CollapsedLOD))
+	{
+		Names.Add(TEXT("CollapsedLOD"));
+	}
+	if (EnumHasAnyFlags(Issues, ELODProfileAuditIssue::MissingLODs))
+	{
+		Names.Add(TEXT("MissingLODs"));
+	}
+	return FString::Join(Names, TEXT(", "));
+}
+
+int32 FLODProfileAuditReport::CountWithIssues() const
+{
+	int32 Count = 0;
+	for (const FLODProfileAuditEntry& Entry : Entries)
+	{
+		Count += Entry.Issues != ELODProfileAuditIssue::None ? 1 : 0;
+	}
+	return Count;
+}
+
+void FLODProfileAuditReport::SortByCost()
+{
+	Entries.StableSort([](const FLODProfileAuditEntry& A, const FLODProfileAuditEntry& B)
+	{
+		const bool bAFlagged = A.Issues != ELODProfileAuditIssue::None;
+		const bool bBFlagged = B.Issues != ELODProfileAuditIssue::None;
+		if (bAFlagged != bBFlagged)
+		{
+			return bAFlagged;
+		}
+		if (A.GpuCost != B.GpuCost)
+		{
+			return A.GpuCost > B.GpuCost;
+		}
+		return A.RenderBytes > B.RenderBytes;
+	});
+}
+
+FString FLODProfileAuditReport::ToString(int32 MaxListed) const
+{
+	int64 TotalBytes = 0;
+	int64 TotalWasted = 0;
+	for (const FLODProfileAuditEntry& Entry : Entries)
+	{
+		TotalBytes += Entry.RenderBytes;
+		TotalWasted += Entry.WastedTriangles;
+	}
+
+	FString Output = FString::Printf(TEXT("Audit: %d of %d mesh(es) flagged, %d failed to load. Render data %.1f MB, ~%lld wasted triangle(s) in LOD chains. %.1fs."),
+		CountWithIssues(), Entries.Num(), NumFailedToLoad, FLODProfileReportFiles::ToMB(TotalBytes), TotalWasted, TotalSeconds);
+
+	int32 NumListed = 0;
+	for (const FLODProfileAuditEntry& Entry : Entries)
+	{
+		if (NumListed >= MaxListed || Entry.Issues == ELODProfileAuditIssue::None)
+		{
+			break;
+		}
+		Output += FString::Printf(TEXT("\n  %s: %s (cost %.0f, %.2f MB)"),
+			*Entry.AssetPath.GetAssetName(), *LexToString(Entry.Issues), Entry.GpuCost, FLODProfileReportFiles::ToMB(Entry.RenderBytes));
+		++NumListed;
+	}
+	return Output;
+}
+
+FString FLODProfileAuditReport::ToJsonString() const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("numMeshes"), Entries.Num());
+	Root->SetNumberField(TEXT("numFlagged"), CountWithIssues());
+	Root->SetNumberField(TEXT("numFailedToLoad"), NumFailedToLoad);
+	Root->SetNumberField(TEXT("totalSeconds"), TotalSeconds);
+
+	TArray<TSharedPtr<FJsonValue>> MeshValues;
+	MeshValues.Reserve(Entries.Num());
+	for (const FLODProfileAuditEntry& Entry : Entries)
+	{
+		TSharedRef<FJsonObject> MeshObject = MakeShared<FJsonObject>();
+		MeshObject->SetStringField(TEXT("path"), Entry.AssetPath.ToString());
+		MeshObject->SetStringField(TEXT("issues"), LexToString(Entry.Issues));
+		MeshObject->SetBoolField(TEXT("nanite"), Entry.bNaniteEnabled);
+		MeshObject->SetArrayField(TEXT("triangles"), FLODProfileReportFiles::ToJsonArray(Entry.Triangles));
+		MeshObject->SetArrayField(TEXT("screenSizes"), FLODProfileReportFiles::ToJsonArray(Entry.ScreenSizes));
+		MeshObject->SetStringField(TEXT("platformSettings"), Entry.PlatformSettings);
+		MeshObject->SetNumberField(TEXT("renderBytes"), double(Entry.RenderBytes));
+		MeshObject->SetNumberField(TEXT("wastedTriangles"), double(Entry.WastedTriangles));
+		MeshObject->SetNumberField(TEXT("gpuCost"), Entry.GpuCost);
+		MeshValues.Add(MakeShared<FJsonValueObject>(MeshObject));
+	}
+	Root->SetArrayField(TEXT("meshes"), MeshValues);
+
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Output;
+}
+
+FString FLODProfileAuditReport::ToCsvString() const
+{
+	FString Output = TEXT("Path,Issues,Nanite,Triangles,ScreenSizes,PlatformSettings,RenderBytes,WastedTriangles,GpuCost\n");
+	for (const FLODProfileAuditEntry& Entry : Entries)
+	{
+		Output += FString::Printf(TEXT("%s,\"%s\",%d,%s,%s,\"%s\",%lld,%lld,%.1f\n"),
+			*Entry.AssetPath.ToString(),
+			*LexToString(Entry.Issues),
+			Entry.bNaniteEnabled ? 1 : 0,
+			*FLODProfileReportFiles::JoinCounts(Entry.Triangles),
+			*FString::JoinBy(Entry.ScreenSizes, TEXT(";"), [](float Value) { return FString::SanitizeFloat(Value); }),
+			*Entry.PlatformSettings,
+			Entry.RenderBytes,
+			Entry.WastedTriangles,
+			Entry.GpuCost);
+	}
+	return Output;
+}
+
+bool FLODProfileAuditReport::SaveToFile(const FString& JsonFilename) const
+{
+	return FLODProfileReportFiles::SaveToFile(JsonFilename, ToJsonString(), ToCsvString());
+}
+
+FString FLODProfileAuditReport::SaveToDefaultLocation(const FString& Name) const
+{
+	return FLODProfileReportFiles::SaveToDefaultLocation(Name, ToJsonString(), ToCsvString());
+}
+
+FLODProfileAuditReport FLODProfileAudit::Run(const TArray<FAssetData>& Assets, const FLODProfileAuditOptions& Options)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_Audit);
+
+	FLODProfileAuditReport Report;
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 WindowSize = Options.MaxAssetsPerWindow > 0 ? Options.MaxAssetsPerWindow : Assets.Num();
+
+	FScopedSlowTask SlowTask(Assets.Num(), LOCTEXT("Auditing", "Auditing LODs..."));
+	SlowTask.MakeDialog(true);
+
+	for (int32 WindowStart = 0; WindowStart < Assets.Num(); WindowStart += WindowSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			break;
+		}
+
+		const int32 WindowEnd = FMath::Min(WindowStart + WindowSize, Assets.Num());
+		SlowTask.EnterProgressFrame(WindowEnd - WindowStart);
+
+		// Let the async loader read the whole window at once instead of loading packages one by one.
+		TArray<FName> LoadedPackageNames;
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_AuditLoad);
+			for (int32 Index = WindowStart; Index < WindowEnd; ++Index)
+			{
+				if (!Assets[Index].IsAssetLoaded())
+				{
+					LoadPackageAsync(Assets[Index].PackageName.ToString());
+					LoadedPackageNames.Add(Assets[Index].PackageName);
+				}
+			}
+			FlushAsyncLoading();
+		}
+
+		TArray<UStaticMesh*> Meshes;
+		for (int32 Index = WindowStart; Index < WindowEnd; ++Index)
+		{
+			if (UStaticMesh* Mesh = Cast<UStaticMesh>(Assets[Index].GetAsset()))
+			{
+				Meshes.Add(Mesh);
+			}
+			else
+			{
+				UE_LOG(LogLODProfileTool, Warning, TEXT("Audit: failed to load %s"), *Assets[Index].GetObjectPathString());
+				++Report.NumFailedToLoad;
+			}
+		}
+
+		FStaticMeshCompilingManager::Get().FinishCompilation(Meshes);
+
+		const int32 FirstEntry = Report.Entries.Num();
+		Report.Entries.SetNum(FirstEntry + Meshes.Num());
+		for (int32 Index = 0; Index < Meshes.Num(); ++Index)
+		{
+			FLODProfileAuditEntry& Entry = Report.Entries[FirstEntry + Index];
+			Entry.AssetPath = FSoftObjectPath(Meshes[Index]);
+			Entry.bNaniteEnabled = Meshes[Index]->IsNaniteEnabled();
+			Entry.PlatformSettings = FLODProfilePlatforms::Describe(Meshes[Index]);
+		}
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_AuditAnalyze);
+			ParallelFor(Meshes.Num(), [&Meshes, &Options, &Report, FirstEntry](int32 Index)
+			{
+				AnalyzeMesh(*Meshes[Index], Options, Report.Entries[FirstEntry + Index]);
+			});
+		}
+
+		// Unload what this window loaded; packages that were already open in the editor stay.
+		Meshes.Reset();
+		TArray<UPackage*> LoadedPackages;
+		for (const FName PackageName : LoadedPackageNames)
+		{
+			if (UPackage* Package = FindPackage(nullptr, *PackageName.ToString()))
+			{
+				LoadedPackages.Add(Package);
+			}
+		}
+		FLODProfileApplicator::ReleasePackages(LoadedPackages);
+	}
+
+	Report.SortByCost();
+	Report.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogLODProfileTool, Display, TEXT("%s"), *Report.ToString());
+	return Report;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "LODProfileTypes.h"
+
+/** Problems the audit can find in a mesh's built LOD chain. */
+enum class ELODProfileAuditIssue : uint32
+{
+	None                 = 0,
+	/** A LOD keeps nearly as many triangles as the LOD before it. */
+	NoReduction          = 1 << 0,
+	/** A LOD switches in at a larger screen size than the LOD before it, so one of them is never drawn. */
+	NonMonotonicScreenSize = 1 << 1,
+	/** LOD1 dropped to a handful of triangles and will visibly pop. */
+	CollapsedLOD         = 1 << 2,
+	/** A dense mesh has no LODs at all. */
+	MissingLODs          = 1 << 3,
+};
+ENUM_CLASS_FLAGS(ELODProfileAuditIssue);
+
+/** Comma separated names of the set issues. */
+FString LexToString(ELODProfileAuditIssue Issues);
+
+/**
+ * Audit result for one mesh, read from its built render data.
+ */
+struct FLODProfileAuditEntry
+{
+	FSoftObjectPath AssetPath;
+	ELODProfileAuditIssue Issues = ELODProfileAuditIssue::None;
+	bool bNaniteEnabled = false;
+
+	TArray<int32> Triangles;
+	TArray<float> ScreenSizes;
+
+	/** Per-platform and per-quality-level minimum LODs and screen sizes, e.g. "MinLOD 0 [Mobile=1]". */
+	FString PlatformSettings;
+
+	/** CPU copies of vertex and index buffers over all LODs. */
+	int64 RenderBytes = 0;
+
+	/** Triangles above what a halving LOD chain would keep; the part of the chain that is wasted. */
+	int64 WastedTriangles = 0;
+
+	/** Triangles weighted by the screen area each LOD covers; proxy for GPU cost. Higher is worse. */
+	double GpuCost = 0.0;
+};
+
+/**
+ * Audit of many meshes, ranked by estimated cost.
+ */
+struct FLODProfileAuditReport
+{
+	TArray<FLODProfileAuditEntry> Entries;
+	int32 NumFailedToLoad = 0;
+	double TotalSeconds = 0.0;
+
+	int32 CountWithIssues() const;
+
+	/** Sorts flagged meshes first, then by GPU cost and memory, descending. */
+	void SortByCost();
+
+	/** Summary plus the most expensive flagged meshes. */
+	FString ToString(int32 MaxListed = 5) const;
+
+	FString ToJsonString() const;
+	FString ToCsvString() const;
+
+	/** Writes the JSON and a CSV with the same name next to it. Returns false on I/O failure. */
+	bool SaveToFile(const FString& JsonFilename) const;
+
+	/** Writes Name.json and Name.csv into the report directory. Returns the JSON path. */
+	FString SaveToDefaultLocation(const FString& Name) const;
+};
+
+/**
+ * Checks built LOD chains for wasted triangles and memory. Packages are loaded through the async loader one window at
+ * a time, render data is analyzed in parallel, and the packages each window loaded are unloaded before the next.
+ */
+class FLODProfileAudit
+{
+public:
+	static FLODProfileAuditReport Run(const TArray<FAssetData>& Assets, const FLODProfileAuditOptions& Options);
+};
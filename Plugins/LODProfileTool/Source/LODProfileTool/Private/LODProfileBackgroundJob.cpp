@@ -0,0 +1,438 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileBackgroundJob.h"
+
+#include "LODProfileApplicator.h"
+#include "LODProfileAssetFilter.h"
+#include "LODProfilePackageSaver.h"
+#include "LODProfileSkeletalMesh.h"
+#include "LODProfileStamp.h"
+#include "LODProfileTool.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "StaticMeshCompiler.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	constexpr double MillisecondsPerSecond = 1000.0;
+
+	/** Jobs stay alive here until they finish, so the panel that started them may close at any time. */
+	TArray<TSharedRef<FLODProfileBackgroundJob>> RunningJobs;
+}
+
+const TCHAR* LexToString(ELODProfileBackgroundAssetState State)
+{
+	switch (State)
+	{
+	case ELODProfileBackgroundAssetState::Queued: return TEXT("Queued");
+	case ELODProfileBackgroundAssetState::Building: return TEXT("Building");
+	case ELODProfileBackgroundAssetState::Applied: return TEXT("Applied");
+	case ELODProfileBackgroundAssetState::Skipped: return TEXT("Skipped");
+	case ELODProfileBackgroundAssetState::Failed: return TEXT("Failed");
+	default: return TEXT("Unknown");
+	}
+}
+
+TSharedRef<FLODProfileBackgroundJob> FLODProfileBackgroundJob::Start(const FLODProfile& Profile, const TArray<FAssetData>& InAssets, const FLODProfileApplyOptions& Options, float FrameBudgetMs)
+{
+	TSharedRef<FLODProfileBackgroundJob> Job = MakeShareable(new FLODProfileBackgroundJob(Profile, Options, FrameBudgetMs));
+
+	// Same registry pre-pass as a synchronous apply: filtered assets go straight to the report.
+	TArray<FSoftObjectPath> PendingPaths;
+	for (const FLODProfileAssetInfo& Info : FLODProfileAssetFilter::EvaluateAll(InAssets, Profile, Options))
+	{
+		if (Info.FilterResult == ELODProfileFilterResult::Process)
+		{
+			TSharedPtr<FLODProfileBackgroundAsset> Asset = MakeShared<FLODProfileBackgroundAsset>();
+			Asset->AssetData = Info.AssetData;
+			Job->Assets.Add(Asset);
+			PendingPaths.Add(Info.AssetData.GetSoftObjectPath());
+			continue;
+		}
+
+		FLODProfileAssetReport& Entry = Job->Report.Assets[Job->Report.AddAsset(Info.AssetData.GetSoftObjectPath())];
+		Entry.Status = ELODProfileAssetStatus::Skipped;
+		Entry.Message = LexToString(Info.FilterResult);
+		++Job->NumFiltered;
+	}
+
+	Job->Journal = FLODProfileJobJournal::Create(Profile, Options, PendingPaths);
+	if (Options.bAutoSave && PendingPaths.Num() > 0)
+	{
+		Job->Journal.Save();
+		UE_LOG(LogLODProfileTool, Log, TEXT("Job %s journal: %s"), *Job->Journal.JobId.ToString(), *Job->Journal.GetFilename());
+	}
+
+	UE_LOG(LogLODProfileTool, Log, TEXT("Applying LOD profile to %d mesh(es) in the background (%d skipped from registry tags, up to %d build(s) in flight)."),
+		Job->Assets.Num(), Job->NumFiltered, Job->MaxInFlight);
+
+	Job->TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(Job, &FLODProfileBackgroundJob::Tick));
+	RunningJobs.Add(Job);
+	return Job;
+}
+
+FLODProfileBackgroundJob::FLODProfileBackgroundJob(const FLODProfile& InProfile, const FLODProfileApplyOptions& InOptions, float FrameBudgetMs)
+	: Profile(InProfile)
+	, ProfileHash(FLODProfileStamp::HashProfile(InProfile))
+	, Options(InOptions)
+	, FrameBudgetSeconds(FMath::Max(1.f, FrameBudgetMs) / MillisecondsPerSecond)
+	, MaxInFlight(InOptions.MaxConcurrentBuilds > 0 ? InOptions.MaxConcurrentBuilds : FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()))
+	, Saver(MakeUnique<FLODProfilePackageSaver>(InOptions.bAsyncSave))
+	, StartTime(FPlatformTime::Seconds())
+	, BaselineDDCStats(FLODProfileDDCStats::Capture())
+	, bStreaming(InOptions.bAutoSave && (InOptions.MaxAssetsPerWindow > 0 || InOptions.MemoryBudgetMB > 0))
+	, MemoryBudgetBytes(uint64(FMath::Max(0, InOptions.MemoryBudgetMB)) * 1024 * 1024)
+	, BaselineUsedPhysical(FPlatformMemory::GetStats().UsedPhysical)
+{
+}
+
+FLODProfileBackgroundJob::~FLODProfileBackgroundJob()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	}
+}
+
+bool FLODProfileBackgroundJob::IsAnyRunning()
+{
+	return RunningJobs.Num() > 0;
+}
+
+void FLODProfileBackgroundJob::CancelAll()
+{
+	// Jobs remove themselves when they complete.
+	const TArray<TSharedRef<FLODProfileBackgroundJob>> Jobs = RunningJobs;
+	for (const TSharedRef<FLODProfileBackgroundJob>& Job : Jobs)
+	{
+		Job->Drain();
+	}
+	RunningJobs.Empty();
+}
+
+void FLODProfileBackgroundJob::Cancel()
+{
+	if (!bFinished && !bCancelled)
+	{
+		bCancelled = true;
+		UE_LOG(LogLODProfileTool, Log, TEXT("Cancelling background LOD profile job %s; waiting for %d build(s) in flight."), *Journal.JobId.ToString(), InFlight.Num());
+	}
+}
+
+double FLODProfileBackgroundJob::GetElapsedSeconds() const
+{
+	return (bFinished ? EndTime : FPlatformTime::Seconds()) - StartTime;
+}
+
+double FLODProfileBackgroundJob::GetAssetsPerSecond() const
+{
+	const double Elapsed = GetElapsedSeconds();
+	return Elapsed > 0.0 ? NumDone / Elapsed : 0.0;
+}
+
+double FLODProfileBackgroundJob::GetSecondsRemaining() const
+{
+	const double Rate = GetAssetsPerSecond();
+	if (bFinished)
+	{
+		return 0.0;
+	}
+	return NumDone > 0 && Rate > 0.0 ? (Assets.Num() - NumDone) / Rate : -1.0;
+}
+
+void FLODProfileBackgroundJob::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (FInFlightBuild& Build : InFlight)
+	{
+		Collector.AddReferencedObject(Build.Mesh);
+	}
+	Collector.AddReferencedObject(LoadedObject);
+}
+
+FString FLODProfileBackgroundJob::GetReferencerName() const
+{
+	return TEXT("FLODProfileBackgroundJob");
+}
+
+bool FLODProfileBackgroundJob::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_BackgroundTick);
+
+	// Everything done on the game thread counts against the budget: finishing and saving built meshes, loading,
+	// and regenerating skeletal LODs. Static mesh builds run on workers, finalized by the compiling manager.
+	const double Deadline = FPlatformTime::Seconds() + FrameBudgetSeconds;
+	FinishBuiltMeshes(Deadline);
+
+	if (bCancelled)
+	{
+		DropLoadedObject();
+	}
+
+	while (!bCancelled && HasAssetsToStart() && !IsWindowClosing() && InFlight.Num() < MaxInFlight && FPlatformTime::Seconds() < Deadline)
+	{
+		StartNextAsset(Deadline);
+	}
+
+	const bool bDrained = InFlight.Num() == 0 && !LoadedObject;
+	if (bDrained && (bCancelled || !HasAssetsToStart()))
+	{
+		Complete();
+		return false;
+	}
+	if (bDrained && IsWindowClosing())
+	{
+		ReleaseWindow();
+	}
+	return true;
+}
+
+bool FLODProfileBackgroundJob::HasAssetsToStart() const
+{
+	return NextAssetIndex < Assets.Num() || LoadedObject;
+}
+
+bool FLODProfileBackgroundJob::IsWindowClosing() const
+{
+	if (!bStreaming || NumInWindow == 0)
+	{
+		return false;
+	}
+	const bool bWindowFull = Options.MaxAssetsPerWindow > 0 && NumInWindow >= Options.MaxAssetsPerWindow;
+	const bool bOverBudget = MemoryBudgetBytes > 0 && FPlatformMemory::GetStats().UsedPhysical > BaselineUsedPhysical + MemoryBudgetBytes;
+	return (bWindowFull || bOverBudget) && !LoadedObject;
+}
+
+void FLODProfileBackgroundJob::ReleaseWindow()
+{
+	// Every mesh of the window is saved; make the writes durable before the journal and the packages go.
+	Saver->Flush();
+	Journal.Save();
+	FLODProfileApplicator::ReleasePackages(WindowPackages);
+	UE_LOG(LogLODProfileTool, Log, TEXT("Processed %d/%d meshes; released window of %d."), NumDone, Assets.Num(), NumInWindow);
+
+	WindowPackages.Reset();
+	NumInWindow = 0;
+	BaselineUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+}
+
+void FLODProfileBackgroundJob::StartNextAsset(double Deadline)
+{
+	// A mesh loaded on the previous tick is edited first; otherwise the next one is loaded.
+	if (!LoadedObject)
+	{
+		LoadedAssetIndex = NextAssetIndex++;
+		FLODProfileBackgroundAsset& Asset = *Assets[LoadedAssetIndex];
+		LoadedStartTime = FPlatformTime::Seconds();
+		Asset.ReportIndex = Report.AddAsset(Asset.AssetData.GetSoftObjectPath());
+		++NumInWindow;
+
+		UObject* Object = nullptr;
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_LoadMesh);
+			Object = Asset.AssetData.GetAsset();
+		}
+		Report.Assets[Asset.ReportIndex].LoadMs = (FPlatformTime::Seconds() - LoadedStartTime) * MillisecondsPerSecond;
+
+		if (!Cast<UStaticMesh>(Object) && !Cast<USkeletalMesh>(Object))
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("Failed to load mesh %s."), *Asset.AssetData.AssetName.ToString());
+			MarkFailed(Asset, TEXT("Failed to load"), LoadedStartTime);
+			return;
+		}
+		WindowPackages.AddUnique(Object->GetOutermost());
+
+		LoadedObject = Object;
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			return;
+		}
+	}
+
+	UObject* Object = LoadedObject;
+	LoadedObject = nullptr;
+	const int32 AssetIndex = LoadedAssetIndex;
+	const double AssetStartTime = LoadedStartTime;
+	FLODProfileBackgroundAsset& Asset = *Assets[AssetIndex];
+	FLODProfileAssetReport& Entry = Report.Assets[Asset.ReportIndex];
+
+	if (Options.bSkipUnchanged && FLODProfileApplicator::IsMeshUpToDate(Object, Profile, ProfileHash))
+	{
+		Entry.Status = ELODProfileAssetStatus::Skipped;
+		Entry.Message = TEXT("Up to date");
+		Entry.Seconds = FPlatformTime::Seconds() - AssetStartTime;
+		Asset.State = ELODProfileBackgroundAssetState::Skipped;
+		Journal.MarkCompleted(Entry.AssetPath);
+		++NumDone;
+		return;
+	}
+
+	if (Options.bAutoSave)
+	{
+		Saver->CheckOut({ Object->GetOutermost() });
+	}
+
+	// Skeletal LODs are regenerated synchronously; only static mesh builds leave the game thread.
+	if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Object))
+	{
+		if (FLODProfileSkeletalMesh::Apply(SkeletalMesh, Profile, ProfileHash, Entry))
+		{
+			MarkApplied(Asset, SkeletalMesh, AssetStartTime);
+		}
+		else
+		{
+			MarkFailed(Asset, FString(), AssetStartTime);
+		}
+		return;
+	}
+
+	UStaticMesh* Mesh = CastChecked<UStaticMesh>(Object);
+	FLODProfileApplicator::BeginMeshApply(Mesh, Profile, ProfileHash, Options, Entry);
+
+	FInFlightBuild& Build = InFlight.AddDefaulted_GetRef();
+	Build.Mesh = Mesh;
+	Build.AssetIndex = AssetIndex;
+	Build.StartTime = AssetStartTime;
+	Build.LaunchTime = FPlatformTime::Seconds();
+	Asset.State = ELODProfileBackgroundAssetState::Building;
+
+	UStaticMesh::FBuildParameters BuildParameters;
+	BuildParameters.bInSilent = true;
+	UStaticMesh::BatchBuild({ Mesh }, BuildParameters);
+}
+
+void FLODProfileBackgroundJob::FinishBuiltMeshes(double Deadline)
+{
+	for (int32 Index = 0; Index < InFlight.Num() && FPlatformTime::Seconds() < Deadline; )
+	{
+		UStaticMesh* Mesh = InFlight[Index].Mesh;
+		if (Mesh->IsCompiling())
+		{
+			++Index;
+			continue;
+		}
+
+		const FInFlightBuild Build = InFlight[Index];
+		InFlight.RemoveAt(Index);
+
+		FLODProfileBackgroundAsset& Asset = *Assets[Build.AssetIndex];
+		FLODProfileAssetReport& Entry = Report.Assets[Asset.ReportIndex];
+		Entry.BuildMs = (FPlatformTime::Seconds() - Build.LaunchTime) * MillisecondsPerSecond;
+		FLODProfileApplicator::FinishMeshApply(Mesh, Profile, ProfileHash, Entry);
+		MarkApplied(Asset, Mesh, Build.StartTime);
+	}
+}
+
+void FLODProfileBackgroundJob::MarkApplied(FLODProfileBackgroundAsset& Asset, UObject* Object, double AssetStartTime)
+{
+	FLODProfileAssetReport& Entry = Report.Assets[Asset.ReportIndex];
+	FLODProfileStamp::WriteSource(Object, Options.ProfileSource, Options.ProfileVersion);
+	Object->MarkPackageDirty();
+
+	if (Options.bAutoSave)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_SavePackage);
+		const double SaveStartTime = FPlatformTime::Seconds();
+		const bool bSaved = Saver->Save(Object->GetOutermost());
+		Entry.SaveMs = (FPlatformTime::Seconds() - SaveStartTime) * MillisecondsPerSecond;
+		if (!bSaved)
+		{
+			MarkFailed(Asset, TEXT("Failed to save"), AssetStartTime);
+			return;
+		}
+	}
+
+	Entry.Status = ELODProfileAssetStatus::Applied;
+	Entry.Seconds = FPlatformTime::Seconds() - AssetStartTime;
+	Entry.UsedMemoryMB = double(FPlatformMemory::GetStats().UsedPhysical) / (1024.0 * 1024.0);
+	Asset.State = ELODProfileBackgroundAssetState::Applied;
+	++NumDone;
+
+	Journal.MarkCompleted(Entry.AssetPath);
+	if (Options.bAutoSave)
+	{
+		Journal.SaveThrottled(/*MinIntervalSeconds=*/5.0, *Saver);
+	}
+}
+
+void FLODProfileBackgroundJob::MarkFailed(FLODProfileBackgroundAsset& Asset, const FString& Message, double AssetStartTime)
+{
+	FLODProfileAssetReport& Entry = Report.Assets[Asset.ReportIndex];
+	Entry.Status = ELODProfileAssetStatus::Failed;
+	if (!Message.IsEmpty())
+	{
+		Entry.Message = Message;
+	}
+	Entry.Seconds = FPlatformTime::Seconds() - AssetStartTime;
+	Asset.State = ELODProfileBackgroundAssetState::Failed;
+	Journal.MarkFailed(Entry.AssetPath);
+	++NumDone;
+	++NumFailed;
+}
+
+void FLODProfileBackgroundJob::DropLoadedObject()
+{
+	if (!LoadedObject)
+	{
+		return;
+	}
+
+	// Loaded but never edited; it stays pending in the journal.
+	FLODProfileBackgroundAsset& Asset = *Assets[LoadedAssetIndex];
+	FLODProfileAssetReport& Entry = Report.Assets[Asset.ReportIndex];
+	Entry.Status = ELODProfileAssetStatus::Skipped;
+	Entry.Message = TEXT("Cancelled");
+	LoadedObject = nullptr;
+}
+
+void FLODProfileBackgroundJob::Drain()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_BackgroundDrain);
+
+	Cancel();
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	}
+	DropLoadedObject();
+
+	TArray<UStaticMesh*> Meshes;
+	for (const FInFlightBuild& Build : InFlight)
+	{
+		Meshes.Add(Build.Mesh);
+	}
+	FStaticMeshCompilingManager::Get().FinishCompilation(Meshes);
+	FinishBuiltMeshes(MAX_dbl);
+
+	Complete();
+}
+
+void FLODProfileBackgroundJob::Complete()
+{
+	TickHandle.Reset();
+	Saver->Flush();
+	Report.DDC += FLODProfileDDCStats::Capture() - BaselineDDCStats;
+
+	Journal.State = bCancelled && Journal.Pending.Num() > 0 ? ELODProfileJobState::Cancelled : ELODProfileJobState::Completed;
+	if (Options.bAutoSave && Assets.Num() > 0)
+	{
+		Journal.Save();
+	}
+	if (Journal.State == ELODProfileJobState::Cancelled)
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("LOD profile job %s cancelled with %d asset(s) pending. Resume it from the LOD Profile tab or with -run=LODProfile -Resume=%s."),
+			*Journal.JobId.ToString(), Journal.Pending.Num(), *Journal.JobId.ToString(EGuidFormats::Digits));
+	}
+
+	EndTime = FPlatformTime::Seconds();
+	bFinished = true;
+	Report.TotalSeconds = EndTime - StartTime;
+	FLODProfileApplicator::FinishReport(Options, Journal.JobId.ToString(EGuidFormats::Digits), Report);
+
+	// Keep this job alive while listeners react, then let the last external reference release it.
+	const TSharedRef<FLODProfileBackgroundJob> Self = AsShared();
+	RunningJobs.Remove(Self);
+	OnFinished.Broadcast();
+}
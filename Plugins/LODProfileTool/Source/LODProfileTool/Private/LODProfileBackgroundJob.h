@@ -0,0 +1,173 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+#include "LODProfileJobJournal.h"
+#include "LODProfileReport.h"
+#include "LODProfileTypes.h"
+#include "UObject/GCObject.h"
+
+class FLODProfilePackageSaver;
+class UPackage;
+class UStaticMesh;
+
+/** Where an asset of a background apply currently is. */
+enum class ELODProfileBackgroundAssetState : uint8
+{
+	Queued,
+	Building,
+	Applied,
+	Skipped,
+	Failed
+};
+
+const TCHAR* LexToString(ELODProfileBackgroundAssetState State);
+
+/** One asset of a background apply, as shown in the progress panel. */
+struct FLODProfileBackgroundAsset
+{
+	FAssetData AssetData;
+	ELODProfileBackgroundAssetState State = ELODProfileBackgroundAssetState::Queued;
+
+	/** Entry in the job's report once the asset was started, else INDEX_NONE. */
+	int32 ReportIndex = INDEX_NONE;
+};
+
+/**
+ * Applies a profile without blocking the editor. Game-thread steps (loading, editing source models, finalizing and
+ * saving) are time-sliced on the core ticker within a per-frame budget, while static mesh builds and reductions run
+ * on worker threads through the asset compiling manager. The job journals and reports like a synchronous run.
+ */
+class FLODProfileBackgroundJob : public FGCObject, public TSharedFromThis<FLODProfileBackgroundJob>
+{
+public:
+	/**
+	 * Filters the assets from registry tags and starts processing the rest on the next tick. The job keeps itself alive
+	 * until it finishes, even when the caller drops its reference.
+	 */
+	static TSharedRef<FLODProfileBackgroundJob> Start(const FLODProfile& Profile, const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options, float FrameBudgetMs);
+
+	virtual ~FLODProfileBackgroundJob();
+
+	/** True while any background job of this editor session has not finished. */
+	static bool IsAnyRunning();
+
+	/**
+	 * Cancels every running job and drains it on the spot: waits for its builds in flight, saves them, flushes its
+	 * saver and writes its journal, so an editor exit leaves resumable jobs rather than ones stuck as running.
+	 */
+	static void CancelAll();
+
+	/** Stops starting new assets. Builds in flight still finish and are saved; queued assets stay pending in the journal. */
+	void Cancel();
+
+	bool IsCancelled() const { return bCancelled; }
+	bool IsFinished() const { return bFinished; }
+
+	/** Assets the job processes, excluding those the registry pre-pass skipped. */
+	const TArray<TSharedPtr<FLODProfileBackgroundAsset>>& GetAssets() const { return Assets; }
+	int32 GetNumFiltered() const { return NumFiltered; }
+	int32 GetNumDone() const { return NumDone; }
+	int32 GetNumFailed() const { return NumFailed; }
+	int32 GetNumInFlight() const { return InFlight.Num(); }
+
+	double GetElapsedSeconds() const;
+
+	/** Finished assets per second since the start. */
+	double GetAssetsPerSecond() const;
+
+	/** Estimated seconds until the last asset finishes, or a negative value before the first one did. */
+	double GetSecondsRemaining() const;
+
+	const FLODProfileApplyReport& GetReport() const { return Report; }
+
+	/** Broadcast on the game thread once the job finished or its cancellation completed. */
+	FSimpleMulticastDelegate OnFinished;
+
+	/** FGCObject interface */
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+
+private:
+	FLODProfileBackgroundJob(const FLODProfile& InProfile, const FLODProfileApplyOptions& InOptions, float FrameBudgetMs);
+
+	bool Tick(float DeltaTime);
+
+	/**
+	 * Loads the next queued asset and edits it; static meshes leave with their build launched. A mesh whose load used
+	 * up the frame budget is kept loaded and edited on the next tick.
+	 */
+	void StartNextAsset(double Deadline);
+
+	/** Finalizes and saves meshes whose builds completed, until the frame budget is spent. */
+	void FinishBuiltMeshes(double Deadline);
+
+	/** Records an applied asset: stamps its source, saves it and updates the journal. */
+	void MarkApplied(FLODProfileBackgroundAsset& Asset, UObject* Object, double StartTime);
+
+	/** Records a failed asset, with an optional reason. */
+	void MarkFailed(FLODProfileBackgroundAsset& Asset, const FString& Message, double StartTime);
+
+	bool HasAssetsToStart() const;
+
+	/** Whether the current window is full or over the memory budget, so no more assets are loaded until it is released. */
+	bool IsWindowClosing() const;
+
+	/** Flushes the window's saves and journal, then unloads its packages, as the blocking apply does between windows. */
+	void ReleaseWindow();
+
+	/** Drops the mesh loaded for the next tick; it stays pending in the journal. */
+	void DropLoadedObject();
+
+	/** Cancels the job and completes it without waiting for further ticks. */
+	void Drain();
+
+	void Complete();
+
+	FLODProfile Profile;
+	FString ProfileHash;
+	FLODProfileApplyOptions Options;
+	double FrameBudgetSeconds;
+	int32 MaxInFlight;
+
+	FLODProfileJobJournal Journal;
+	FLODProfileApplyReport Report;
+	TUniquePtr<FLODProfilePackageSaver> Saver;
+
+	TArray<TSharedPtr<FLODProfileBackgroundAsset>> Assets;
+	int32 NextAssetIndex = 0;
+	int32 NumFiltered = 0;
+	int32 NumDone = 0;
+	int32 NumFailed = 0;
+
+	struct FInFlightBuild
+	{
+		TObjectPtr<UStaticMesh> Mesh;
+		int32 AssetIndex = INDEX_NONE;
+		double StartTime = 0.0;
+		double LaunchTime = 0.0;
+	};
+	TArray<FInFlightBuild> InFlight;
+
+	/** Mesh loaded by the previous tick that still has to be edited. */
+	TObjectPtr<UObject> LoadedObject;
+	int32 LoadedAssetIndex = INDEX_NONE;
+	double LoadedStartTime = 0.0;
+
+	/** Window of loaded assets, released once all of them are saved. Only used with auto-save. */
+	bool bStreaming = false;
+	int32 NumInWindow = 0;
+	TArray<UPackage*> WindowPackages;
+	uint64 MemoryBudgetBytes = 0;
+	uint64 BaselineUsedPhysical = 0;
+
+	double StartTime = 0.0;
+	double EndTime = 0.0;
+	FLODProfileDDCStats BaselineDDCStats;
+	bool bCancelled = false;
+	bool bFinished = false;
+	FTSTicker::FDelegateHandle TickHandle;
+};
@@ -0,0 +1,386 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileBenchmarkCommandlet.h"
+
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "LODProfileApplicator.h"
+#include "LODProfileReport.h"
+#include "LODProfileTool.h"
+#include "LODProfileToolSettings.h"
+#include "MeshDescription.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "StaticMeshAttributes.h"
+#include "StaticMeshCompiler.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	constexpr TCHAR BenchmarkPackageRoot[] = TEXT("/Temp/LODProfileBenchmark");
+
+	FString GetParam(const TMap<FString, FString>& ParamsMap, const TCHAR* Key, const FString& Default)
+	{
+		const FString* Value = ParamsMap.Find(Key);
+		return Value ? *Value : Default;
+	}
+
+	TArray<int32> ParseIntList(const TMap<FString, FString>& ParamsMap, const TCHAR* Key, const TCHAR* Default)
+	{
+		TArray<FString> Parts;
+		GetParam(ParamsMap, Key, Default).ParseIntoArray(Parts, TEXT("+"));
+
+		TArray<int32> Result;
+		for (const FString& Part : Parts)
+		{
+			const int32 Number = FCString::Atoi(*Part);
+			if (Number > 0)
+			{
+				Result.Add(Number);
+			}
+		}
+		return Result;
+	}
+
+	double GetUsedMemoryMB()
+	{
+		return double(FPlatformMemory::GetStats().UsedPhysical) / (1024.0 * 1024.0);
+	}
+
+	/**
+	 * Samples process memory on its own thread. The game thread is blocked inside the applicator for the whole run, so
+	 * neither a ticker nor per-asset samples would see the peaks of a batched build.
+	 */
+	class FPeakMemorySampler
+	{
+	public:
+		FPeakMemorySampler()
+			: PeakUsedMemoryMB(GetUsedMemoryMB())
+		{
+			Sampler = Async(EAsyncExecution::Thread, [this]()
+			{
+				while (!bStop)
+				{
+					PeakUsedMemoryMB = FMath::Max(PeakUsedMemoryMB, GetUsedMemoryMB());
+					FPlatformProcess::Sleep(SampleIntervalSeconds);
+				}
+			});
+		}
+
+		~FPeakMemorySampler()
+		{
+			Stop();
+		}
+
+		/** Stops sampling and returns the highest process memory seen, in MB. */
+		double Stop()
+		{
+			bStop = true;
+			if (Sampler.IsValid())
+			{
+				Sampler.Wait();
+				Sampler.Reset();
+			}
+			return FMath::Max(PeakUsedMemoryMB, GetUsedMemoryMB());
+		}
+
+	private:
+		static constexpr float SampleIntervalSeconds = 0.005f;
+
+		std::atomic<bool> bStop = false;
+
+		/** Only written by the sampler thread until Stop joined it. */
+		double PeakUsedMemoryMB;
+
+		TFuture<void> Sampler;
+	};
+}
+
+ULODProfileBenchmarkCommandlet::ULODProfileBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 ULODProfileBenchmarkCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	const TArray<int32> TriangleCounts = ParseIntList(ParamsMap, TEXT("Triangles"), TEXT("2000+20000+200000"));
+	const TArray<int32> LODCounts = ParseIntList(ParamsMap, TEXT("LODs"), TEXT("2+4"));
+	const int32 MeshesPerScenario = FMath::Max(1, FCString::Atoi(*GetParam(ParamsMap, TEXT("MeshesPerScenario"), TEXT("8"))));
+	const double TolerancePercent = FMath::Max(0.0, FCString::Atod(*GetParam(ParamsMap, TEXT("Tolerance"), TEXT("10"))));
+	const FString BaselinePath = GetParam(ParamsMap, TEXT("Baseline"), FPaths::Combine(GetBenchmarkDirectory(), TEXT("Baseline.json")));
+	const FString OutputPath = GetParam(ParamsMap, TEXT("Output"), FPaths::Combine(GetBenchmarkDirectory(),
+		FString::Printf(TEXT("Benchmark_%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")))));
+
+	if (TriangleCounts.Num() == 0 || LODCounts.Num() == 0)
+	{
+		UE_LOG(LogLODProfileTool, Error, TEXT("-Triangles and -LODs need at least one positive value each."));
+		return 1;
+	}
+
+	TArray<FLODProfileBenchmarkResult> Results;
+	for (const int32 TrianglesPerMesh : TriangleCounts)
+	{
+		for (const int32 NumLODs : LODCounts)
+		{
+			const FLODProfileBenchmarkResult& Result = Results.Add_GetRef(RunScenario(TrianglesPerMesh, NumLODs, MeshesPerScenario));
+			UE_LOG(LogLODProfileTool, Display, TEXT("%s: %.2fs, %.2f meshes/s, %.0f triangles/s, +%.0f MB peak."),
+				*Result.Name, Result.Seconds, Result.MeshesPerSecond, Result.TrianglesPerSecond, Result.PeakMemoryDeltaMB);
+		}
+	}
+
+	const TSharedRef<FJsonObject> ResultsJson = ResultsToJson(Results);
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(ResultsJson, Writer);
+
+	if (FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		UE_LOG(LogLODProfileTool, Display, TEXT("Wrote benchmark results to %s"), *FPaths::ConvertRelativePathToFull(OutputPath));
+	}
+
+	if (Switches.Contains(TEXT("WriteBaseline")))
+	{
+		if (!FFileHelper::SaveStringToFile(Json, *BaselinePath))
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Failed to write baseline to %s"), *BaselinePath);
+			return 1;
+		}
+		UE_LOG(LogLODProfileTool, Display, TEXT("Wrote baseline to %s"), *FPaths::ConvertRelativePathToFull(BaselinePath));
+		return 0;
+	}
+
+	FString BaselineJson;
+	TSharedPtr<FJsonObject> Baseline;
+	if (!FFileHelper::LoadFileToString(BaselineJson, *BaselinePath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineJson), Baseline)
+		|| !Baseline.IsValid())
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("No baseline at %s; run with -WriteBaseline to record one."), *BaselinePath);
+		return 0;
+	}
+
+	const int32 NumRegressions = CompareToBaseline(Results, Baseline.ToSharedRef(), TolerancePercent);
+	if (NumRegressions > 0)
+	{
+		UE_LOG(LogLODProfileTool, Error, TEXT("%d benchmark regression(s) beyond %.0f%% tolerance."), NumRegressions, TolerancePercent);
+		return 1;
+	}
+
+	UE_LOG(LogLODProfileTool, Display, TEXT("All benchmark scenarios within %.0f%% of baseline."), TolerancePercent);
+	return 0;
+}
+
+FLODProfileBenchmarkResult ULODProfileBenchmarkCommandlet::RunScenario(int32 TrianglesPerMesh, int32 NumLODs, int32 NumMeshes)
+{
+	FLODProfileBenchmarkResult Result;
+	Result.Name = FString::Printf(TEXT("Tris%d_LODs%d"), TrianglesPerMesh, NumLODs);
+	Result.NumMeshes = NumMeshes;
+	Result.NumLODs = NumLODs;
+
+	// Generation and the initial LOD0 build are not part of the measurement.
+	TArray<UStaticMesh*> Meshes;
+	TArray<FAssetData> Assets;
+	for (int32 Index = 0; Index < NumMeshes; ++Index)
+	{
+		UStaticMesh* Mesh = CreateSyntheticMesh(FString::Printf(TEXT("SM_%s_%d"), *Result.Name, Index), TrianglesPerMesh);
+		Meshes.Add(Mesh);
+		Assets.Emplace(Mesh);
+	}
+	FStaticMeshCompilingManager::Get().FinishAllCompilation();
+	Result.TrianglesPerMesh = Meshes[0]->GetNumTriangles(0);
+
+	// Profile spacing comes from project settings; only the LOD count varies per scenario.
+	FLODProfile Profile = ULODProfileToolSettings::Get()->BuildProfile();
+	Profile.NumLODs = NumLODs;
+	Profile.bOverrideExisting = true;
+
+	FLODProfileApplyOptions Options = ULODProfileToolSettings::Get()->BuildApplyOptions();
+	Options.bAutoSave = false;
+	Options.bSkipUnchanged = false;
+	Options.bWriteReport = false;
+	Options.MinTrianglesToProcess = 0;
+
+	const double StartMemoryMB = GetUsedMemoryMB();
+	FPeakMemorySampler PeakMemory;
+	FLODProfileApplyReport Report;
+	FLODProfileApplicator::ApplyProfileToAssets(Profile, Assets, Options, &Report);
+	Result.PeakMemoryDeltaMB = FMath::Max(0.0, PeakMemory.Stop() - StartMemoryMB);
+
+	Result.Seconds = Report.TotalSeconds;
+	Result.NumApplied = Report.CountWithStatus(ELODProfileAssetStatus::Applied);
+	if (Result.NumApplied != NumMeshes)
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("%s: only %d of %d meshes were applied."), *Result.Name, Result.NumApplied, NumMeshes);
+	}
+	if (Result.Seconds > 0.0)
+	{
+		Result.MeshesPerSecond = Result.NumApplied / Result.Seconds;
+		Result.TrianglesPerSecond = double(Result.NumApplied) * Result.TrianglesPerMesh / Result.Seconds;
+	}
+
+	for (UStaticMesh* Mesh : Meshes)
+	{
+		Mesh->ClearFlags(RF_Standalone);
+		Mesh->GetOutermost()->MarkAsGarbage();
+	}
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return Result;
+}
+
+UStaticMesh* ULODProfileBenchmarkCommandlet::CreateSyntheticMesh(const FString& Name, int32 NumTriangles)
+{
+	// A grid of Resolution x Resolution quads, rippled so reduction has real curvature to preserve.
+	const int32 Resolution = FMath::Max(1, FMath::RoundToInt(FMath::Sqrt(NumTriangles * 0.5)));
+	constexpr float Spacing = 10.0f;
+	constexpr float Amplitude = 25.0f;
+
+	FMeshDescription MeshDescription;
+	FStaticMeshAttributes Attributes(MeshDescription);
+	Attributes.Register();
+
+	TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+	const FPolygonGroupID PolygonGroup = MeshDescription.CreatePolygonGroup();
+	Attributes.GetPolygonGroupMaterialSlotNames()[PolygonGroup] = TEXT("Default");
+
+	const int32 VerticesPerRow = Resolution + 1;
+	MeshDescription.ReserveNewVertices(VerticesPerRow * VerticesPerRow);
+	MeshDescription.ReserveNewVertexInstances(Resolution * Resolution * 6);
+	MeshDescription.ReserveNewTriangles(Resolution * Resolution * 2);
+
+	TArray<FVertexID> Vertices;
+	Vertices.Reserve(VerticesPerRow * VerticesPerRow);
+	for (int32 Y = 0; Y < VerticesPerRow; ++Y)
+	{
+		for (int32 X = 0; X < VerticesPerRow; ++X)
+		{
+			const float U = float(X) / Resolution;
+			const float V = float(Y) / Resolution;
+			const FVertexID Vertex = MeshDescription.CreateVertex();
+			Positions[Vertex] = FVector3f(X * Spacing, Y * Spacing,
+				Amplitude * FMath::Sin(U * 4.0f * UE_PI) * FMath::Cos(V * 3.0f * UE_PI));
+			Vertices.Add(Vertex);
+		}
+	}
+
+	auto AddCorner = [&](int32 X, int32 Y)
+	{
+		const FVertexInstanceID Instance = MeshDescription.CreateVertexInstance(Vertices[Y * VerticesPerRow + X]);
+		UVs.Set(Instance, 0, FVector2f(float(X) / Resolution, float(Y) / Resolution));
+		return Instance;
+	};
+
+	for (int32 Y = 0; Y < Resolution; ++Y)
+	{
+		for (int32 X = 0; X < Resolution; ++X)
+		{
+			const FVertexInstanceID Corner00 = AddCorner(X, Y);
+			const FVertexInstanceID Corner10 = AddCorner(X + 1, Y);
+			const FVertexInstanceID Corner11 = AddCorner(X + 1, Y + 1);
+			const FVertexInstanceID Corner01 = AddCorner(X, Y + 1);
+			const FVertexInstanceID First[] = { Corner00, Corner11, Corner10 };
+			const FVertexInstanceID Second[] = { Corner00, Corner01, Corner11 };
+			MeshDescription.CreateTriangle(PolygonGroup, First);
+			MeshDescription.CreateTriangle(PolygonGroup, Second);
+		}
+	}
+
+	UPackage* Package = CreatePackage(*FString::Printf(TEXT("%s/%s"), BenchmarkPackageRoot, *Name));
+	UStaticMesh* Mesh = NewObject<UStaticMesh>(Package, *Name, RF_Public | RF_Standalone);
+	Mesh->GetStaticMaterials().Add(FStaticMaterial(nullptr, TEXT("Default")));
+	Mesh->SetNumSourceModels(1);
+	Mesh->CreateMeshDescription(0, MoveTemp(MeshDescription));
+	Mesh->CommitMeshDescription(0);
+	Mesh->Build(/*bInSilent=*/true);
+	return Mesh;
+}
+
+int32 ULODProfileBenchmarkCommandlet::CompareToBaseline(const TArray<FLODProfileBenchmarkResult>& Results, const TSharedRef<FJsonObject>& Baseline, double TolerancePercent)
+{
+	TMap<FString, TSharedPtr<FJsonObject>> BaselineByName;
+	const TArray<TSharedPtr<FJsonValue>>* Scenarios = nullptr;
+	if (Baseline->TryGetArrayField(TEXT("scenarios"), Scenarios))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *Scenarios)
+		{
+			const TSharedPtr<FJsonObject>* Scenario = nullptr;
+			if (Value->TryGetObject(Scenario))
+			{
+				BaselineByName.Add((*Scenario)->GetStringField(TEXT("name")), *Scenario);
+			}
+		}
+	}
+
+	const double Slack = TolerancePercent / 100.0;
+	int32 NumRegressions = 0;
+	for (const FLODProfileBenchmarkResult& Result : Results)
+	{
+		const TSharedPtr<FJsonObject>* Expected = BaselineByName.Find(Result.Name);
+		if (!Expected)
+		{
+			UE_LOG(LogLODProfileTool, Display, TEXT("%s: not in baseline."), *Result.Name);
+			continue;
+		}
+
+		const double BaselineMeshesPerSecond = (*Expected)->GetNumberField(TEXT("meshesPerSecond"));
+		if (Result.MeshesPerSecond < BaselineMeshesPerSecond * (1.0 - Slack))
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("%s: %.2f meshes/s, baseline %.2f."), *Result.Name, Result.MeshesPerSecond, BaselineMeshesPerSecond);
+			++NumRegressions;
+		}
+
+		// Small growths are noise; only compare memory once the baseline grew by a meaningful amount.
+		const double BaselineMemoryMB = (*Expected)->GetNumberField(TEXT("peakMemoryDeltaMB"));
+		constexpr double MinMemoryToCompareMB = 64.0;
+		if (BaselineMemoryMB >= MinMemoryToCompareMB && Result.PeakMemoryDeltaMB > BaselineMemoryMB * (1.0 + Slack))
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("%s: +%.0f MB peak, baseline +%.0f MB."), *Result.Name, Result.PeakMemoryDeltaMB, BaselineMemoryMB);
+			++NumRegressions;
+		}
+	}
+	return NumRegressions;
+}
+
+TSharedRef<FJsonObject> ULODProfileBenchmarkCommandlet::ResultsToJson(const TArray<FLODProfileBenchmarkResult>& Results)
+{
+	TArray<TSharedPtr<FJsonValue>> Scenarios;
+	for (const FLODProfileBenchmarkResult& Result : Results)
+	{
+		TSharedRef<FJsonObject> Scenario = MakeShared<FJsonObject>();
+		Scenario->SetStringField(TEXT("name"), Result.Name);
+		Scenario->SetNumberField(TEXT("meshes"), Result.NumMeshes);
+		Scenario->SetNumberField(TEXT("applied"), Result.NumApplied);
+		Scenario->SetNumberField(TEXT("trianglesPerMesh"), Result.TrianglesPerMesh);
+		Scenario->SetNumberField(TEXT("numLODs"), Result.NumLODs);
+		Scenario->SetNumberField(TEXT("seconds"), Result.Seconds);
+		Scenario->SetNumberField(TEXT("meshesPerSecond"), Result.MeshesPerSecond);
+		Scenario->SetNumberField(TEXT("trianglesPerSecond"), Result.TrianglesPerSecond);
+		Scenario->SetNumberField(TEXT("peakMemoryDeltaMB"), Result.PeakMemoryDeltaMB);
+		Scenarios.Add(MakeShared<FJsonValueObject>(Scenario));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("date"), FDateTime::UtcNow().ToIso8601());
+	Root->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+	Root->SetArrayField(TEXT("scenarios"), Scenarios);
+	return Root;
+}
+
+FString ULODProfileBenchmarkCommandlet::GetBenchmarkDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("LODProfileTool"), TEXT("Benchmarks"));
+}
@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LODProfileBenchmarkCommandlet.generated.h"
+
+class UStaticMesh;
+class FJsonObject;
+
+/** Measured result of one benchmark scenario. */
+struct FLODProfileBenchmarkResult
+{
+	FString Name;
+	int32 NumMeshes = 0;
+	int32 NumApplied = 0;
+	int32 TrianglesPerMesh = 0;
+	int32 NumLODs = 0;
+	double Seconds = 0.0;
+	double MeshesPerSecond = 0.0;
+	double TrianglesPerSecond = 0.0;
+
+	/** Highest process memory growth over the scenario's starting point, sampled throughout the run. */
+	double PeakMemoryDeltaMB = 0.0;
+};
+
+/**
+ * Measures applicator throughput on synthetic meshes generated in memory, and compares it against a stored baseline.
+ *
+ * UnrealEditor-Cmd <Project> -run=LODProfileBenchmark -nullrhi [-Triangles=2000+20000+200000] [-LODs=2+4]
+ *     [-MeshesPerScenario=8] [-Baseline=Baseline.json] [-Tolerance=10] [-WriteBaseline] [-Output=Results.json]
+ *
+ * Every triangle count is run with every LOD count. Nothing is saved to disk except the result files.
+ * Returns non-zero when a scenario's throughput drops, or its memory grows, by more than -Tolerance percent.
+ */
+UCLASS()
+class ULODProfileBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULODProfileBenchmarkCommandlet();
+
+	/** UCommandlet interface */
+	virtual int32 Main(const FString& Params) override;
+
+	/** Applies a profile with NumLODs to freshly generated meshes and measures the run. */
+	static FLODProfileBenchmarkResult RunScenario(int32 TrianglesPerMesh, int32 NumLODs, int32 NumMeshes);
+
+	/** Compares results against the baseline and logs every regression. Returns the number of regressions. */
+	static int32 CompareToBaseline(const TArray<FLODProfileBenchmarkResult>& Results, const TSharedRef<FJsonObject>& Baseline, double TolerancePercent);
+
+	static TSharedRef<FJsonObject> ResultsToJson(const TArray<FLODProfileBenchmarkResult>& Results);
+
+private:
+	/** Creates an unsaved static mesh with a single LOD of roughly NumTriangles triangles of a rippled grid. */
+	static UStaticMesh* CreateSyntheticMesh(const FString& Name, int32 NumTriangles);
+
+	/** Default directory for results and the baseline: Saved/LODProfileTool/Benchmarks. */
+	static FString GetBenchmarkDirectory();
+};
@@ -0,0 +1,369 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/StaticMesh.h"
+#include "JsonObjectConverter.h"
+#include "LODProfileApplicator.h"
+#include "LODProfileAsset.h"
+#include "LODProfileAudit.h"
+#include "LODProfileEstimate.h"
+#include "LODProfileJobJournal.h"
+#include "LODProfileReport.h"
+#include "LODProfileRuleSet.h"
+#include "LODProfileShards.h"
+#include "LODProfileStale.h"
+#include "LODProfileTool.h"
+#include "LODProfileToolSettings.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+ULODProfileCommandlet::ULODProfileCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 ULODProfileCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	FLODProfileApplyReport Report;
+	if (Switches.Contains(TEXT("Resume")) || ParamsMap.Contains(TEXT("Resume")))
+	{
+		FLODProfileJobJournal Journal;
+		const FString* JobId = ParamsMap.Find(TEXT("Resume"));
+		const bool bFound = JobId ? FLODProfileJobJournal::Load(*JobId, Journal) : FLODProfileJobJournal::FindLatestResumable(Journal);
+		if (!bFound)
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("No resumable LOD profile job found."));
+			return 1;
+		}
+		if (Journal.IsOwnerAlive())
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("LOD profile job %s is still running in process %u."), *Journal.JobId.ToString(), Journal.OwnerProcessId);
+			return 1;
+		}
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.SearchAllAssets(/*bSynchronousSearch=*/true);
+		Journal.Options.bWriteReport = false;
+		FLODProfileApplicator::ResumeJob(Journal, &Report);
+		return WriteReport(ParamsMap, Report);
+	}
+
+	if (Switches.Contains(TEXT("Audit")))
+	{
+		TArray<FAssetData> Assets;
+		if (!GatherAssets(ParamsMap, !Switches.Contains(TEXT("NonRecursive")), Assets))
+		{
+			return 1;
+		}
+
+		const FLODProfileAuditReport Audit = FLODProfileAudit::Run(Assets, ULODProfileToolSettings::Get()->BuildAuditOptions());
+		if (!WriteAudit(ParamsMap, Audit))
+		{
+			return 1;
+		}
+		return Switches.Contains(TEXT("FailOnIssues")) && Audit.CountWithIssues() > 0 ? 1 : 0;
+	}
+
+	const bool bUseRules = Switches.Contains(TEXT("Rules"));
+	const bool bRebuildStale = Switches.Contains(TEXT("RebuildStale"));
+	FLODProfile Profile;
+	FString ProfileSource;
+	int32 ProfileVersion = 0;
+	if (!bUseRules && !bRebuildStale)
+	{
+		if (!LoadProfile(ParamsMap, Profile, ProfileSource, ProfileVersion))
+		{
+			return 1;
+		}
+
+		FString Error;
+		if (!FLODProfileApplicator::ValidateProfile(Profile, Error))
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Profile invalid: %s"), *Error);
+			return 1;
+		}
+	}
+
+	const bool bRecursive = !Switches.Contains(TEXT("NonRecursive"));
+	TArray<FAssetData> Assets;
+	if (!GatherAssets(ParamsMap, bRecursive, Assets))
+	{
+		return 1;
+	}
+
+	FLODProfileApplyOptions Options = ULODProfileToolSettings::Get()->BuildApplyOptions();
+	if (Switches.Contains(TEXT("AutoSave")))
+	{
+		Options.bAutoSave = true;
+	}
+	else if (Switches.Contains(TEXT("NoSave")))
+	{
+		Options.bAutoSave = false;
+	}
+	if (Switches.Contains(TEXT("Force")))
+	{
+		Options.bSkipUnchanged = false;
+	}
+	if (const FString* MaxConcurrentBuilds = ParamsMap.Find(TEXT("MaxConcurrentBuilds")))
+	{
+		Options.MaxConcurrentBuilds = FMath::Max(0, FCString::Atoi(**MaxConcurrentBuilds));
+	}
+	// The commandlet writes its report to -Report instead.
+	Options.bWriteReport = false;
+	Options.ProfileSource = ProfileSource;
+	Options.ProfileVersion = ProfileVersion;
+
+	const int32 NumWorkers = FCString::Atoi(*ParamsMap.FindRef(TEXT("Workers")));
+	if (NumWorkers > 1 && !Switches.Contains(TEXT("DryRun")))
+	{
+		return RunWorkers(Switches, ParamsMap, Assets, NumWorkers, Report);
+	}
+
+	if (bRebuildStale)
+	{
+		// Each stale mesh is rebuilt with the current state of the profile recorded in its own stamp.
+		const FLODProfileStaleScan Scan = FLODProfileStale::Scan(Assets);
+		UE_LOG(LogLODProfileTool, Display, TEXT("%s"), *Scan.ToString());
+		if (Switches.Contains(TEXT("DryRun")))
+		{
+			return WriteEstimate(ParamsMap, FLODProfileApplicator::EstimateStale(Scan, Options));
+		}
+		FLODProfileApplicator::RebuildStale(Scan, Options, &Report);
+		return WriteReport(ParamsMap, Report);
+	}
+
+	if (Switches.Contains(TEXT("DryRun")))
+	{
+		const FLODProfileEstimate Estimate = bUseRules
+			? FLODProfileApplicator::EstimateProfileRules(FLODProfileRuleSet::FromSettings(), Assets, Options)
+			: FLODProfileApplicator::EstimateProfile(Profile, Assets, Options);
+		return WriteEstimate(ParamsMap, Estimate);
+	}
+
+	if (bUseRules)
+	{
+		const FLODProfileRuleSet RuleSet = FLODProfileRuleSet::FromSettings();
+		UE_LOG(LogLODProfileTool, Display, TEXT("Applying %d LOD profile rule(s) to %d asset(s)."), RuleSet.NumRules(), Assets.Num());
+		FLODProfileApplicator::ApplyProfileRules(RuleSet, Assets, Options, &Report);
+		return WriteReport(ParamsMap, Report);
+	}
+
+	UE_LOG(LogLODProfileTool, Display, TEXT("Applying LOD profile to %d asset(s)."), Assets.Num());
+
+	FLODProfileApplicator::ApplyProfileToAssets(Profile, Assets, Options, &Report);
+	return WriteReport(ParamsMap, Report);
+}
+
+int32 ULODProfileCommandlet::RunWorkers(const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap, const TArray<FAssetData>& Assets, int32 NumWorkers, FLODProfileApplyReport& Report)
+{
+	// Workers only share results through saved packages, so they always save.
+	if (Switches.Contains(TEXT("NoSave")))
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("-NoSave is ignored with -Workers; worker processes save their packages."));
+	}
+
+	FLODProfileShardOptions ShardOptions;
+	ShardOptions.NumWorkers = NumWorkers;
+	ShardOptions.WorkingDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("LODProfileTool"), TEXT("Shards"), FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+	// Split the machine's cores between the workers instead of each one building on all of them.
+	const int32 BuildsPerWorker = FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads() / NumWorkers);
+	ShardOptions.WorkerArguments = FString::Printf(TEXT("-AutoSave -MaxConcurrentBuilds=%d"), BuildsPerWorker);
+	for (const TCHAR* ForwardedSwitch : { TEXT("Rules"), TEXT("RebuildStale"), TEXT("Force") })
+	{
+		if (Switches.Contains(ForwardedSwitch))
+		{
+			ShardOptions.WorkerArguments += FString::Printf(TEXT(" -%s"), ForwardedSwitch);
+		}
+	}
+	if (const FString* ProfileFile = ParamsMap.Find(TEXT("ProfileFile")))
+	{
+		ShardOptions.WorkerArguments += FString::Printf(TEXT(" -ProfileFile=\"%s\""), *FPaths::ConvertRelativePathToFull(*ProfileFile));
+	}
+	if (const FString* ProfileAsset = ParamsMap.Find(TEXT("ProfileAsset")))
+	{
+		ShardOptions.WorkerArguments += FString::Printf(TEXT(" -ProfileAsset=\"%s\""), **ProfileAsset);
+	}
+
+	UE_LOG(LogLODProfileTool, Display, TEXT("Splitting %d asset(s) across %d worker process(es) in %s."), Assets.Num(), NumWorkers, *ShardOptions.WorkingDirectory);
+	const bool bAllLaunched = FLODProfileShards::Run(Assets, ShardOptions, Report);
+	const int32 ExitCode = WriteReport(ParamsMap, Report);
+	return bAllLaunched ? ExitCode : 1;
+}
+
+int32 ULODProfileCommandlet::WriteReport(const TMap<FString, FString>& ParamsMap, const FLODProfileApplyReport& Report)
+{
+	FString ReportPath = ParamsMap.FindRef(TEXT("Report"));
+	if (ReportPath.IsEmpty())
+	{
+		ReportPath = FPaths::Combine(FLODProfileApplyReport::GetDefaultReportDirectory(),
+			FString::Printf(TEXT("LODProfile_%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+	}
+	if (Report.SaveToFile(ReportPath) && Report.SaveCsvToFile(FPaths::ChangeExtension(ReportPath, TEXT("csv"))))
+	{
+		UE_LOG(LogLODProfileTool, Display, TEXT("Wrote report to %s"), *FPaths::ConvertRelativePathToFull(ReportPath));
+	}
+	else
+	{
+		UE_LOG(LogLODProfileTool, Error, TEXT("Failed to write report to %s"), *ReportPath);
+	}
+
+	const int32 NumFailed = Report.CountWithStatus(ELODProfileAssetStatus::Failed);
+	UE_LOG(LogLODProfileTool, Display, TEXT("Applied %d, skipped %d, failed %d in %.2fs."),
+		Report.CountWithStatus(ELODProfileAssetStatus::Applied),
+		Report.CountWithStatus(ELODProfileAssetStatus::Skipped),
+		NumFailed,
+		Report.TotalSeconds);
+
+	return NumFailed > 0 ? 1 : 0;
+}
+
+int32 ULODProfileCommandlet::WriteEstimate(const TMap<FString, FString>& ParamsMap, const FLODProfileEstimate& Estimate)
+{
+	UE_LOG(LogLODProfileTool, Display, TEXT("%s"), *Estimate.ToString());
+
+	FString ReportPath = ParamsMap.FindRef(TEXT("Report"));
+	if (ReportPath.IsEmpty())
+	{
+		ReportPath = FPaths::Combine(FLODProfileApplyReport::GetDefaultReportDirectory(),
+			FString::Printf(TEXT("LODProfileEstimate_%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+	}
+	if (!Estimate.SaveToFile(ReportPath))
+	{
+		UE_LOG(LogLODProfileTool, Error, TEXT("Failed to write estimate to %s"), *ReportPath);
+		return 1;
+	}
+
+	UE_LOG(LogLODProfileTool, Display, TEXT("Wrote estimate to %s"), *FPaths::ConvertRelativePathToFull(ReportPath));
+	return 0;
+}
+
+bool ULODProfileCommandlet::WriteAudit(const TMap<FString, FString>& ParamsMap, const FLODProfileAuditReport& Audit)
+{
+	FString ReportPath = ParamsMap.FindRef(TEXT("Report"));
+	if (ReportPath.IsEmpty())
+	{
+		ReportPath = FPaths::Combine(FLODProfileApplyReport::GetDefaultReportDirectory(),
+			FString::Printf(TEXT("LODProfileAudit_%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+	}
+	if (!Audit.SaveToFile(ReportPath))
+	{
+		UE_LOG(LogLODProfileTool, Error, TEXT("Failed to write audit to %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogLODProfileTool, Display, TEXT("Wrote audit to %s"), *FPaths::ConvertRelativePathToFull(ReportPath));
+	return true;
+}
+
+bool ULODProfileCommandlet::LoadProfile(const TMap<FString, FString>& ParamsMap, FLODProfile& OutProfile, FString& OutSource, int32& OutVersion)
+{
+	OutSource.Reset();
+	OutVersion = 0;
+
+	if (const FString* ProfileAssetParam = ParamsMap.Find(TEXT("ProfileAsset")))
+	{
+		// Accept package paths as well as object paths.
+		FString ObjectPath = *ProfileAssetParam;
+		if (!ObjectPath.Contains(TEXT(".")))
+		{
+			ObjectPath += TEXT(".") + FPackageName::GetShortName(ObjectPath);
+		}
+
+		const ULODProfileAsset* ProfileAsset = LoadObject<ULODProfileAsset>(nullptr, *ObjectPath);
+		if (!ProfileAsset)
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Could not load LOD profile asset %s"), **ProfileAssetParam);
+			return false;
+		}
+
+		OutProfile = ProfileAsset->GetSanitizedProfile();
+		OutSource = ProfileAsset->GetPathName();
+		OutVersion = ProfileAsset->Version;
+		UE_LOG(LogLODProfileTool, Display, TEXT("Using LOD profile asset %s, version %d."), *OutSource, OutVersion);
+		return true;
+	}
+
+	const FString* ProfileFile = ParamsMap.Find(TEXT("ProfileFile"));
+	if (!ProfileFile)
+	{
+		OutProfile = ULODProfileToolSettings::Get()->BuildProfile();
+		OutSource = FLODProfileRuleSet::FallbackProfileName.ToString();
+		return true;
+	}
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, **ProfileFile))
+	{
+		UE_LOG(LogLODProfileTool, Error, TEXT("Could not read profile file %s"), **ProfileFile);
+		return false;
+	}
+
+	// Start from project settings so the override file only needs the fields it changes.
+	OutProfile = ULODProfileToolSettings::Get()->BuildProfile();
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutProfile))
+	{
+		UE_LOG(LogLODProfileTool, Error, TEXT("Could not parse profile file %s"), **ProfileFile);
+		return false;
+	}
+	return true;
+}
+
+bool ULODProfileCommandlet::GatherAssets(const TMap<FString, FString>& ParamsMap, bool bRecursive, TArray<FAssetData>& OutAssets)
+{
+	if (const FString* ShardFile = ParamsMap.Find(TEXT("ShardFile")))
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.SearchAllAssets(/*bSynchronousSearch=*/true);
+		if (!FLODProfileShards::LoadShardFile(*ShardFile, OutAssets))
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Could not read shard file %s"), **ShardFile);
+			return false;
+		}
+		return true;
+	}
+
+	const FString* PathParam = ParamsMap.Find(TEXT("Path"));
+	if (!PathParam || PathParam->IsEmpty())
+	{
+		UE_LOG(LogLODProfileTool, Error, TEXT("Missing -Path=/Game/... argument."));
+		return false;
+	}
+
+	TArray<FString> Paths;
+	PathParam->ParseIntoArray(Paths, TEXT("+"));
+
+	TArray<FTopLevelAssetPath> ClassPaths;
+	TArray<FString> ClassNames;
+	const FString* ClassParam = ParamsMap.Find(TEXT("Class"));
+	(ClassParam ? *ClassParam : FString(TEXT("StaticMesh"))).ParseIntoArray(ClassNames, TEXT("+"));
+	for (const FString& ClassName : ClassNames)
+	{
+		const UClass* Class = ClassName.StartsWith(TEXT("/"))
+			? FindObject<UClass>(nullptr, *ClassName)
+			: FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::None);
+		if (!Class)
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Unknown class filter %s"), *ClassName);
+			return false;
+		}
+		ClassPaths.Add(Class->GetClassPathName());
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(/*bSynchronousSearch=*/true);
+	FLODProfileApplicator::GatherAssets(Paths, ClassPaths, bRecursive, OutAssets);
+	return true;
+}
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LODProfileTypes.h"
+#include "LODProfileCommandlet.generated.h"
+
+struct FLODProfileApplyReport;
+struct FLODProfileAuditReport;
+struct FLODProfileEstimate;
+
+/**
+ * Headless entry point for applying LOD profiles on build machines.
+ *
+ * UnrealEditor-Cmd <Project> -run=LODProfile -Path=/Game/Meshes [-Class=StaticMesh] [-ProfileFile=Profile.json|-ProfileAsset=/Game/LODProfiles/LP_Props]
+ *     [-Report=Summary.json] [-AutoSave|-NoSave] [-NonRecursive] [-Force] [-Rules|-RebuildStale] [-DryRun] [-Workers=N] [-MaxConcurrentBuilds=N] [-nullrhi]
+ *
+ * UnrealEditor-Cmd <Project> -run=LODProfile -Resume[=JobId] [-Report=Summary.json]
+ *
+ * UnrealEditor-Cmd <Project> -run=LODProfile -Audit -Path=/Game [-Report=Audit.json] [-FailOnIssues]
+ *
+ * Multiple paths or classes can be separated with '+'. -Rules picks each mesh's profile from the rule table in
+ * project settings instead of using a single profile. -ProfileAsset applies a profile library asset and stamps the meshes
+ * with its path and version. -RebuildStale only rebuilds meshes whose stamp no longer matches the current state of the
+ * profile that built them, each with that profile. -Workers splits the assets into N shards of similar LOD0 triangle
+ * count and applies each in its own headless editor process on this machine, then merges their reports. -DryRun writes a triangle and render data estimate to -Report
+ * instead of applying anything. -Resume continues the given job, or the most recent
+ * unfinished one, from its journal in Saved/LODProfileTool/Jobs. -Audit checks the built LOD chains under -Path and
+ * writes them ranked by cost; with -FailOnIssues it returns non-zero if any mesh was flagged. Otherwise returns
+ * non-zero if any asset failed.
+ */
+UCLASS()
+class ULODProfileCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULODProfileCommandlet();
+
+	/** UCommandlet interface */
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/**
+	 * Loads the profile from -ProfileAsset or -ProfileFile when given, otherwise from project settings.
+	 * OutSource and OutVersion receive the stamp identity; profile files are ad hoc and have none.
+	 */
+	static bool LoadProfile(const TMap<FString, FString>& ParamsMap, FLODProfile& OutProfile, FString& OutSource, int32& OutVersion);
+
+	/** Gathers assets under the requested paths matching the class filter, without loading them. */
+	static bool GatherAssets(const TMap<FString, FString>& ParamsMap, bool bRecursive, TArray<FAssetData>& OutAssets);
+
+	/** Coordinator for -Workers: applies the assets through worker processes and writes the merged report. */
+	static int32 RunWorkers(const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap, const TArray<FAssetData>& Assets, int32 NumWorkers, FLODProfileApplyReport& Report);
+
+	/** Writes the JSON summary to -Report or the default report directory and returns the exit code. */
+	static int32 WriteReport(const TMap<FString, FString>& ParamsMap, const FLODProfileApplyReport& Report);
+
+	/** Writes the dry-run estimate as JSON and CSV to -Report or the default report directory. */
+	static int32 WriteEstimate(const TMap<FString, FString>& ParamsMap, const FLODProfileEstimate& Estimate);
+
+	/** Writes the audit as JSON and CSV to -Report or the default report directory. */
+	static bool WriteAudit(const TMap<FString, FString>& ParamsMap, const FLODProfileAuditReport& Audit);
+};
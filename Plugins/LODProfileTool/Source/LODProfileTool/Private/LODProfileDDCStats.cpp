@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileDDCStats.h"
+
+#include "ProfilingDebugging/CookStats.h"
+
+#if ENABLE_COOK_STATS
+namespace
+{
+	/** Usage stat names the engine registers for mesh render data in the derived data cache. */
+	const TCHAR* const MeshUsageStatNames[] = { TEXT("StaticMesh.Usage"), TEXT("SkeletalMesh.Usage") };
+
+	const FString* FindAttribute(const TArray<FCookStatsManager::StringKeyValue>& Attributes, const TCHAR* Key)
+	{
+		for (const FCookStatsManager::StringKeyValue& Attribute : Attributes)
+		{
+			if (Attribute.Key == Key)
+			{
+				return &Attribute.Value;
+			}
+		}
+		return nullptr;
+	}
+}
+#endif
+
+FLODProfileDDCStats FLODProfileDDCStats::Capture()
+{
+	FLODProfileDDCStats Stats;
+#if ENABLE_COOK_STATS
+	FCookStatsManager::LogCookStats([&Stats](const FString& StatName, const TArray<FCookStatsManager::StringKeyValue>& Attributes)
+	{
+		bool bMeshStat = false;
+		for (const TCHAR* MeshStatName : MeshUsageStatNames)
+		{
+			bMeshStat |= StatName == MeshStatName;
+		}
+
+		// Each entry is one thread and call type; only lookups count, not the puts that follow a miss.
+		const FString* Call = FindAttribute(Attributes, TEXT("Call"));
+		const FString* HitOrMiss = FindAttribute(Attributes, TEXT("HitOrMiss"));
+		const FString* Count = FindAttribute(Attributes, TEXT("Count"));
+		if (!bMeshStat || !Call || *Call != TEXT("Get") || !HitOrMiss || !Count)
+		{
+			return;
+		}
+
+		if (*HitOrMiss == TEXT("Hit"))
+		{
+			Stats.Hits += FCString::Atoi64(**Count);
+			if (const FString* MB = FindAttribute(Attributes, TEXT("MB")))
+			{
+				Stats.HitMB += FCString::Atod(**MB);
+			}
+		}
+		else
+		{
+			Stats.Misses += FCString::Atoi64(**Count);
+		}
+	});
+#endif
+	return Stats;
+}
+
+bool FLODProfileDDCStats::IsAvailable()
+{
+	return ENABLE_COOK_STATS != 0;
+}
+
+FLODProfileDDCStats FLODProfileDDCStats::operator-(const FLODProfileDDCStats& Other) const
+{
+	FLODProfileDDCStats Result;
+	Result.Hits = Hits - Other.Hits;
+	Result.Misses = Misses - Other.Misses;
+	Result.HitMB = HitMB - Other.HitMB;
+	return Result;
+}
+
+FLODProfileDDCStats& FLODProfileDDCStats::operator+=(const FLODProfileDDCStats& Other)
+{
+	Hits += Other.Hits;
+	Misses += Other.Misses;
+	HitMB += Other.HitMB;
+	return *this;
+}
+
+double FLODProfileDDCStats::GetHitRate() const
+{
+	const int64 Lookups = Hits + Misses;
+	return Lookups > 0 ? double(Hits) / double(Lookups) : 0.0;
+}
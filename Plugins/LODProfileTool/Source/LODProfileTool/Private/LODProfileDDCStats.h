@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Snapshot of the engine's mesh render data cache counters. The engine keys reduced render data by the source mesh
+ * hash plus build and reduction settings, so the difference between two snapshots tells how many builds of a run were
+ * fetched from a local or shared derived data cache instead of being reduced again.
+ */
+struct FLODProfileDDCStats
+{
+	/** Render data fetched from the cache. */
+	int64 Hits = 0;
+
+	/** Render data built because the cache had no entry. */
+	int64 Misses = 0;
+
+	/** Megabytes fetched by the hits. */
+	double HitMB = 0.0;
+
+	/** Reads the cumulative static and skeletal mesh counters. All zero when the engine is built without cook stats. */
+	static FLODProfileDDCStats Capture();
+
+	/** False when the engine does not collect the counters. */
+	static bool IsAvailable();
+
+	FLODProfileDDCStats operator-(const FLODProfileDDCStats& Other) const;
+	FLODProfileDDCStats& operator+=(const FLODProfileDDCStats& Other);
+
+	/** Fraction of lookups served from the cache, 0 when there were none. */
+	double GetHitRate() const;
+};
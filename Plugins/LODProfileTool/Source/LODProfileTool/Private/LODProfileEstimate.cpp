@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileEstimate.h"
+
+#include "Dom/JsonObject.h"
+#include "LODProfileReport.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	int64 Sum(const TArray<int64>& Values)
+	{
+		int64 Total = 0;
+		for (const int64 Value : Values)
+		{
+			Total += Value;
+		}
+		return Total;
+	}
+}
+
+int32 FLODProfileEstimate::CountWillChange() const
+{
+	int32 Count = 0;
+	for (const FLODProfileMeshEstimate& Mesh : Meshes)
+	{
+		Count += Mesh.bWillChange ? 1 : 0;
+	}
+	return Count;
+}
+
+int64 FLODProfileEstimate::GetTotalTrianglesBefore() const
+{
+	int64 Total = 0;
+	for (const FLODProfileMeshEstimate& Mesh : Meshes)
+	{
+		Total += Sum(Mesh.TrianglesBefore);
+	}
+	return Total;
+}
+
+int64 FLODProfileEstimate::GetTotalTrianglesAfter() const
+{
+	int64 Total = 0;
+	for (const FLODProfileMeshEstimate& Mesh : Meshes)
+	{
+		Total += Sum(Mesh.TrianglesAfter);
+	}
+	return Total;
+}
+
+int64 FLODProfileEstimate::GetTotalBytesBefore() const
+{
+	int64 Total = 0;
+	for (const FLODProfileMeshEstimate& Mesh : Meshes)
+	{
+		Total += Mesh.BytesBefore;
+	}
+	return Total;
+}
+
+int64 FLODProfileEstimate::GetTotalBytesAfter() const
+{
+	int64 Total = 0;
+	for (const FLODProfileMeshEstimate& Mesh : Meshes)
+	{
+		Total += Mesh.BytesAfter;
+	}
+	return Total;
+}
+
+FString FLODProfileEstimate::ToString() const
+{
+	const int64 BytesBefore = GetTotalBytesBefore();
+	const int64 BytesAfter = GetTotalBytesAfter();
+	return FString::Printf(TEXT("Estimate: %d of %d mesh(es) would change. Triangles over all LODs %lld -> %lld. Render data ~%.1f MB -> %.1f MB (%+.1f MB)."),
+		CountWillChange(), Meshes.Num(), GetTotalTrianglesBefore(), GetTotalTrianglesAfter(),
+		FLODProfileReportFiles::ToMB(BytesBefore), FLODProfileReportFiles::ToMB(BytesAfter), FLODProfileReportFiles::ToMB(BytesAfter - BytesBefore));
+}
+
+FString FLODProfileEstimate::ToJsonString() const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("numMeshes"), Meshes.Num());
+	Root->SetNumberField(TEXT("numWillChange"), CountWillChange());
+	Root->SetNumberField(TEXT("trianglesBefore"), double(GetTotalTrianglesBefore()));
+	Root->SetNumberField(TEXT("trianglesAfter"), double(GetTotalTrianglesAfter()));
+	Root->SetNumberField(TEXT("bytesBefore"), double(GetTotalBytesBefore()));
+	Root->SetNumberField(TEXT("bytesAfter"), double(GetTotalBytesAfter()));
+
+	TArray<TSharedPtr<FJsonValue>> MeshValues;
+	MeshValues.Reserve(Meshes.Num());
+	for (const FLODProfileMeshEstimate& Mesh : Meshes)
+	{
+		TSharedRef<FJsonObject> MeshObject = MakeShared<FJsonObject>();
+		MeshObject->SetStringField(TEXT("path"), Mesh.AssetPath.ToString());
+		if (!Mesh.ProfileName.IsNone())
+		{
+			MeshObject->SetStringField(TEXT("profile"), Mesh.ProfileName.ToString());
+		}
+		MeshObject->SetBoolField(TEXT("willChange"), Mesh.bWillChange);
+		MeshObject->SetBoolField(TEXT("nanite"), Mesh.bNaniteEnabled);
+		MeshObject->SetArrayField(TEXT("trianglesBefore"), FLODProfileReportFiles::ToJsonArray(Mesh.TrianglesBefore));
+		MeshObject->SetArrayField(TEXT("trianglesAfter"), FLODProfileReportFiles::ToJsonArray(Mesh.TrianglesAfter));
+		MeshObject->SetNumberField(TEXT("bytesBefore"), double(Mesh.BytesBefore));
+		MeshObject->SetNumberField(TEXT("bytesAfter"), double(Mesh.BytesAfter));
+		if (!Mesh.Message.IsEmpty())
+		{
+			MeshObject->SetStringField(TEXT("message"), Mesh.Message);
+		}
+		MeshValues.Add(MakeShared<FJsonValueObject>(MeshObject));
+	}
+	Root->SetArrayField(TEXT("meshes"), MeshValues);
+
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Output;
+}
+
+FString FLODProfileEstimate::ToCsvString() const
+{
+	FString Output = TEXT("Path,Profile,WillChange,Nanite,TrianglesBefore,TrianglesAfter,BytesBefore,BytesAfter,Message\n");
+	for (const FLODProfileMeshEstimate& Mesh : Meshes)
+	{
+		Output += FString::Printf(TEXT("%s,%s,%d,%d,%s,%s,%lld,%lld,\"%s\"\n"),
+			*Mesh.AssetPath.ToString(),
+			Mesh.ProfileName.IsNone() ? TEXT("") : *Mesh.ProfileName.ToString(),
+			Mesh.bWillChange ? 1 : 0,
+			Mesh.bNaniteEnabled ? 1 : 0,
+			*FLODProfileReportFiles::JoinCounts(Mesh.TrianglesBefore),
+			*FLODProfileReportFiles::JoinCounts(Mesh.TrianglesAfter),
+			Mesh.BytesBefore,
+			Mesh.BytesAfter,
+			*Mesh.Message.Replace(TEXT("\""), TEXT("'")));
+	}
+	return Output;
+}
+
+bool FLODProfileEstimate::SaveToFile(const FString& JsonFilename) const
+{
+	return FLODProfileReportFiles::SaveToFile(JsonFilename, ToJsonString(), ToCsvString());
+}
+
+FString FLODProfileEstimate::SaveToDefaultLocation(const FString& Name) const
+{
+	return FLODProfileReportFiles::SaveToDefaultLocation(Name, ToJsonString(), ToCsvString());
+}
@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+/**
+ * Predicted effect of a profile on one mesh, computed from asset registry tags without loading or building it.
+ */
+struct FLODProfileMeshEstimate
+{
+	FSoftObjectPath AssetPath;
+
+	/** Named profile chosen by the rule table, or NAME_None for a single-profile estimate. */
+	FName ProfileName;
+
+	/** False when the mesh would be skipped; After then equals Before. */
+	bool bWillChange = false;
+
+	bool bNaniteEnabled = false;
+
+	/** Triangles per LOD. LODs above 0 of the current mesh are not in the registry and assumed to halve per LOD. */
+	TArray<int64> TrianglesBefore;
+	TArray<int64> TrianglesAfter;
+
+	/** Estimated vertex and index buffer bytes summed over all LODs, which dominate the render data on disk. */
+	int64 BytesBefore = 0;
+	int64 BytesAfter = 0;
+
+	/** Reason the mesh would be skipped. */
+	FString Message;
+};
+
+/**
+ * Dry-run estimate for a selection or folder, with totals and export helpers.
+ */
+struct FLODProfileEstimate
+{
+	TArray<FLODProfileMeshEstimate> Meshes;
+
+	int32 CountWillChange() const;
+	int64 GetTotalTrianglesBefore() const;
+	int64 GetTotalTrianglesAfter() const;
+	int64 GetTotalBytesBefore() const;
+	int64 GetTotalBytesAfter() const;
+
+	/** Single-line summary for logs and the tab. */
+	FString ToString() const;
+
+	/** Serializes the totals and every mesh estimate to JSON. */
+	FString ToJsonString() const;
+
+	/** One row per mesh, for spreadsheets. */
+	FString ToCsvString() const;
+
+	/** Writes the JSON and a CSV with the same name next to it. Returns false on I/O failure. */
+	bool SaveToFile(const FString& JsonFilename) const;
+
+	/** Writes Name.json and Name.csv into the report directory. Returns the JSON path. */
+	FString SaveToDefaultLocation(const FString& Name) const;
+};
@@ -0,0 +1,178 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileImportHook.h"
+
+#include "Containers/Ticker.h"
+#include "Editor.h"
+#include "Engine/StaticMesh.h"
+#include "LODProfileApplicator.h"
+#include "LODProfileRuleSet.h"
+#include "LODProfileTool.h"
+#include "LODProfileToolSettings.h"
+#include "Misc/CoreDelegates.h"
+#include "Subsystems/ImportSubsystem.h"
+
+namespace
+{
+	TArray<TWeakObjectPtr<UStaticMesh>> PendingMeshes;
+
+	/** Pending meshes that were reimported. Their new geometry is not covered by the stamp, so they are never skipped. */
+	TSet<TWeakObjectPtr<UStaticMesh>> ReimportedMeshes;
+
+	/** Package names of meshes the Interchange pipeline prepared, consumed once their import event was processed. */
+	TSet<FName> PreparedPackages;
+	FDelegateHandle PostEngineInitHandle;
+	FDelegateHandle PostImportHandle;
+	FDelegateHandle ReimportHandle;
+	FTSTicker::FDelegateHandle ProcessTickHandle;
+}
+
+void FLODProfileImportHook::Register()
+{
+	if (IsRunningCommandlet())
+	{
+		return;
+	}
+
+	// Default-phase modules start before the editor engine exists.
+	if (GEditor)
+	{
+		Subscribe();
+	}
+	else
+	{
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddStatic(&FLODProfileImportHook::Subscribe);
+	}
+}
+
+void FLODProfileImportHook::Unregister()
+{
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(ProcessTickHandle);
+	ProcessTickHandle.Reset();
+	PendingMeshes.Empty();
+	ReimportedMeshes.Empty();
+	PreparedPackages.Empty();
+
+	if (GEditor)
+	{
+		if (UImportSubsystem* ImportSubsystem = GEditor->GetEditorSubsystem<UImportSubsystem>())
+		{
+			ImportSubsystem->OnAssetPostImport.Remove(PostImportHandle);
+			ImportSubsystem->OnAssetReimport.Remove(ReimportHandle);
+		}
+	}
+}
+
+void FLODProfileImportHook::MarkPrepared(const UStaticMesh* Mesh)
+{
+	if (Mesh && ULODProfileToolSettings::Get()->bApplyProfileOnImport)
+	{
+		PreparedPackages.Add(Mesh->GetOutermost()->GetFName());
+	}
+}
+
+void FLODProfileImportHook::Subscribe()
+{
+	if (UImportSubsystem* ImportSubsystem = GEditor ? GEditor->GetEditorSubsystem<UImportSubsystem>() : nullptr)
+	{
+		PostImportHandle = ImportSubsystem->OnAssetPostImport.AddStatic(&FLODProfileImportHook::OnAssetPostImport);
+		ReimportHandle = ImportSubsystem->OnAssetReimport.AddStatic(&FLODProfileImportHook::OnAssetReimport);
+	}
+}
+
+void FLODProfileImportHook::OnAssetPostImport(UFactory* Factory, UObject* Object)
+{
+	Enqueue(Object);
+}
+
+void FLODProfileImportHook::OnAssetReimport(UObject* Object)
+{
+	if (UStaticMesh* Mesh = Cast<UStaticMesh>(Object))
+	{
+		ReimportedMeshes.Add(Mesh);
+	}
+	Enqueue(Object);
+}
+
+void FLODProfileImportHook::Enqueue(UObject* Object)
+{
+	UStaticMesh* Mesh = Cast<UStaticMesh>(Object);
+	if (!Mesh || !ULODProfileToolSettings::Get()->bApplyProfileOnImport)
+	{
+		return;
+	}
+
+	PendingMeshes.AddUnique(Mesh);
+	if (!ProcessTickHandle.IsValid())
+	{
+		ProcessTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FLODProfileImportHook::ProcessPending));
+	}
+}
+
+bool FLODProfileImportHook::ProcessPending(float DeltaTime)
+{
+	ProcessTickHandle.Reset();
+
+	// New imports may carry an up-to-date stamp from an earlier apply and are skipped then. A reimport keeps the stamp of
+	// the old geometry, so those meshes are always applied.
+	TArray<FAssetData> Imported;
+	TArray<FAssetData> Reimported;
+	for (const TWeakObjectPtr<UStaticMesh>& Mesh : PendingMeshes)
+	{
+		if (Mesh.IsValid() && PreparedPackages.Remove(Mesh->GetOutermost()->GetFName()) > 0)
+		{
+			// Already configured before its build by the Interchange pipeline, which does not tell reimports apart.
+			continue;
+		}
+		if (Mesh.IsValid())
+		{
+			(ReimportedMeshes.Contains(Mesh) ? Reimported : Imported).Emplace(Mesh.Get());
+		}
+	}
+	PendingMeshes.Empty();
+	ReimportedMeshes.Empty();
+	if (Imported.IsEmpty() && Reimported.IsEmpty())
+	{
+		return false;
+	}
+
+	const ULODProfileToolSettings* Settings = ULODProfileToolSettings::Get();
+
+	// Imported packages are left dirty for the user to save with the rest of the import.
+	FLODProfileApplyOptions Options = Settings->BuildApplyOptions();
+	Options.bAutoSave = false;
+
+	FLODProfile Profile;
+	if (Settings->ProfileRules.IsEmpty())
+	{
+		Profile = Settings->BuildProfile();
+		FString Error;
+		if (!FLODProfileApplicator::ValidateProfile(Profile, Error))
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Profile invalid, not applying on import: %s"), *Error);
+			return false;
+		}
+		Options.ProfileSource = FLODProfileRuleSet::FallbackProfileName.ToString();
+	}
+
+	int32 Applied = 0;
+	for (const bool bReimport : { false, true })
+	{
+		const TArray<FAssetData>& Assets = bReimport ? Reimported : Imported;
+		if (Assets.IsEmpty())
+		{
+			continue;
+		}
+
+		Options.bSkipUnchanged = !bReimport;
+		Applied += Settings->ProfileRules.IsEmpty()
+			? FLODProfileApplicator::ApplyProfileToAssets(Profile, Assets, Options)
+			: FLODProfileApplicator::ApplyProfileRules(FLODProfileRuleSet::FromSettings(), Assets, Options);
+	}
+
+	UE_LOG(LogLODProfileTool, Log, TEXT("Applied LOD profile to %d of %d imported mesh(es)."), Applied, Imported.Num() + Reimported.Num());
+
+	// One-shot ticker
+	return false;
+}
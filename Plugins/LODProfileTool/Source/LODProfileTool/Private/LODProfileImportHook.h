@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UFactory;
+class UStaticMesh;
+
+/**
+ * Applies the project's LOD profile (or profile rules) to static meshes as they are imported or reimported.
+ *
+ * Meshes arriving in the same frame are coalesced and applied as one batched build on the next tick. Meshes that the
+ * LOD Profile Interchange pipeline already configured and stamped during this import, including reimports, are dropped
+ * from the queue, so they are built only once. Other reimported meshes are always applied, since their stamp predates
+ * the new geometry. Controlled by the Apply Profile On Import setting.
+ */
+class FLODProfileImportHook
+{
+public:
+	static void Register();
+	static void Unregister();
+
+	/** Called by the Interchange pipeline for a mesh it configured and stamped before its build, so the hook skips it. */
+	static void MarkPrepared(const UStaticMesh* Mesh);
+
+private:
+	static void Subscribe();
+	static void OnAssetPostImport(UFactory* Factory, UObject* Object);
+	static void OnAssetReimport(UObject* Object);
+	static void Enqueue(UObject* Object);
+	static bool ProcessPending(float DeltaTime);
+};
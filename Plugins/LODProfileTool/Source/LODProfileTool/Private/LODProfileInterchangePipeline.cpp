@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileInterchangePipeline.h"
+
+#include "Engine/StaticMesh.h"
+#include "LODProfileApplicator.h"
+#include "LODProfileImportHook.h"
+#include "LODProfileRuleSet.h"
+#include "LODProfileTool.h"
+#include "LODProfileToolSettings.h"
+
+bool ULODProfileInterchangePipeline::CanExecuteOnAnyThread(EInterchangePipelineTask PipelineTask)
+{
+	// Source models are UObject state and must be edited on the game thread.
+	return PipelineTask != EInterchangePipelineTask::PostFactoryCallback;
+}
+
+void ULODProfileInterchangePipeline::ExecutePostFactoryPipeline(const UInterchangeBaseNodeContainer* BaseNodeContainer, const FString& FactoryNodeKey, UObject* CreatedAsset, bool bIsAReimport)
+{
+	UStaticMesh* Mesh = Cast<UStaticMesh>(CreatedAsset);
+	if (!Mesh)
+	{
+		return;
+	}
+
+	const ULODProfileToolSettings* Settings = ULODProfileToolSettings::Get();
+	if (Settings->ProfileRules.IsEmpty())
+	{
+		const FLODProfile Profile = Settings->BuildProfile();
+		FString Error;
+		if (FLODProfileApplicator::ValidateProfile(Profile, Error))
+		{
+			if (FLODProfileApplicator::PrepareMeshForBuild(Mesh, Profile, FLODProfileRuleSet::FallbackProfileName.ToString()))
+			{
+				FLODProfileImportHook::MarkPrepared(Mesh);
+			}
+		}
+		else
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Profile invalid, not applying to %s: %s"), *Mesh->GetName(), *Error);
+		}
+		return;
+	}
+
+	// The mesh is not built yet, so rules on triangle counts or bounds cannot match at this point.
+	const FLODProfileRuleSet RuleSet = FLODProfileRuleSet::FromSettings();
+	const FName ProfileName = RuleSet.FindProfileName(FAssetData(Mesh));
+	if (const FLODProfile* Profile = RuleSet.FindProfile(ProfileName))
+	{
+		FString ProfileSource;
+		int32 ProfileVersion = 0;
+		RuleSet.GetProfileSource(ProfileName, ProfileSource, ProfileVersion);
+		if (FLODProfileApplicator::PrepareMeshForBuild(Mesh, *Profile, ProfileSource, ProfileVersion))
+		{
+			FLODProfileImportHook::MarkPrepared(Mesh);
+		}
+	}
+}
@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InterchangePipelineBase.h"
+#include "LODProfileInterchangePipeline.generated.h"
+
+/**
+ * Interchange pipeline that configures LOD source models on newly created static meshes before their first build, so
+ * the importer's build already produces the profile's LODs. Add a pipeline asset of this class to the project's
+ * Interchange import stack. The profile comes from the rule table in project settings, or the default profile.
+ */
+UCLASS(BlueprintType, EditInlineNew, meta = (DisplayName = "LOD Profile"))
+class ULODProfileInterchangePipeline : public UInterchangePipelineBase
+{
+	GENERATED_BODY()
+
+public:
+	/** UInterchangePipelineBase interface */
+	virtual bool CanExecuteOnAnyThread(EInterchangePipelineTask PipelineTask) override;
+
+protected:
+	/** Runs after the factory created the asset and before it is built. */
+	virtual void ExecutePostFactoryPipeline(const UInterchangeBaseNodeContainer* BaseNodeContainer, const FString& FactoryNodeKey, UObject* CreatedAsset, bool bIsAReimport) override;
+};
@@ -0,0 +1,276 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileJobJournal.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "JsonObjectConverter.h"
+#include "LODProfilePackageSaver.h"
+#include "LODProfileTool.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	TArray<TSharedPtr<FJsonValue>> PathsToJson(const TArray<FSoftObjectPath>& Paths)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		Values.Reserve(Paths.Num());
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			Values.Add(MakeShared<FJsonValueString>(Path.ToString()));
+		}
+		return Values;
+	}
+
+	TArray<FSoftObjectPath> PathsFromJson(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field)
+	{
+		TArray<FSoftObjectPath> Paths;
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (Object->TryGetArrayField(Field, Values))
+		{
+			Paths.Reserve(Values->Num());
+			for (const TSharedPtr<FJsonValue>& Value : *Values)
+			{
+				Paths.Emplace(Value->AsString());
+			}
+		}
+		return Paths;
+	}
+
+	ELODProfileJobState StateFromString(const FString& Text)
+	{
+		if (Text == TEXT("Cancelled"))
+		{
+			return ELODProfileJobState::Cancelled;
+		}
+		if (Text == TEXT("Completed"))
+		{
+			return ELODProfileJobState::Completed;
+		}
+		return ELODProfileJobState::Running;
+	}
+}
+
+const TCHAR* LexToString(ELODProfileJobState State)
+{
+	switch (State)
+	{
+	case ELODProfileJobState::Running:   return TEXT("Running");
+	case ELODProfileJobState::Cancelled: return TEXT("Cancelled");
+	case ELODProfileJobState::Completed: return TEXT("Completed");
+	}
+	return TEXT("Unknown");
+}
+
+FLODProfileJobJournal FLODProfileJobJournal::Create(const FLODProfile& InProfile, const FLODProfileApplyOptions& InOptions, const TArray<FSoftObjectPath>& InPending)
+{
+	FLODProfileJobJournal Journal;
+	Journal.JobId = FGuid::NewGuid();
+	Journal.CreatedTime = FDateTime::UtcNow();
+	Journal.Profile = InProfile;
+	Journal.Options = InOptions;
+	Journal.Pending.Append(InPending);
+	Journal.ClaimOwnership();
+	return Journal;
+}
+
+void FLODProfileJobJournal::ClaimOwnership()
+{
+	OwnerProcessId = FPlatformProcess::GetCurrentProcessId();
+	OwnerExecutable = FPlatformProcess::ExecutableName();
+}
+
+bool FLODProfileJobJournal::IsOwnerAlive() const
+{
+	if (State != ELODProfileJobState::Running || OwnerProcessId == 0)
+	{
+		return false;
+	}
+	if (OwnerProcessId == FPlatformProcess::GetCurrentProcessId())
+	{
+		// Jobs end before their process does, so a running journal of this process is a live job.
+		return true;
+	}
+	if (!FPlatformProcess::IsApplicationRunning(OwnerProcessId))
+	{
+		return false;
+	}
+	return FPaths::GetBaseFilename(FPlatformProcess::GetApplicationName(OwnerProcessId)) == FPaths::GetBaseFilename(OwnerExecutable);
+}
+
+void FLODProfileJobJournal::MarkCompleted(const FSoftObjectPath& AssetPath)
+{
+	Pending.Remove(AssetPath);
+	Completed.Add(AssetPath);
+}
+
+void FLODProfileJobJournal::MarkFailed(const FSoftObjectPath& AssetPath)
+{
+	Pending.Remove(AssetPath);
+	Failed.Add(AssetPath);
+}
+
+FString FLODProfileJobJournal::GetJournalDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("LODProfileTool"), TEXT("Jobs"));
+}
+
+FString FLODProfileJobJournal::GetFilename() const
+{
+	return FPaths::Combine(GetJournalDirectory(), JobId.ToString(EGuidFormats::Digits) + TEXT(".json"));
+}
+
+bool FLODProfileJobJournal::Save() const
+{
+	if (State == ELODProfileJobState::Completed)
+	{
+		const FString Filename = GetFilename();
+		IFileManager::Get().Delete(*(Filename + TEXT(".tmp")), /*RequireExists=*/false, /*EvenReadOnly=*/true, /*Quiet=*/true);
+		return IFileManager::Get().Delete(*Filename, /*RequireExists=*/false, /*EvenReadOnly=*/true, /*Quiet=*/true);
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("jobId"), JobId.ToString(EGuidFormats::Digits));
+	Root->SetStringField(TEXT("created"), CreatedTime.ToIso8601());
+	Root->SetStringField(TEXT("state"), LexToString(State));
+	Root->SetNumberField(TEXT("ownerPid"), OwnerProcessId);
+	Root->SetStringField(TEXT("ownerExecutable"), OwnerExecutable);
+
+	TSharedRef<FJsonObject> ProfileObject = MakeShared<FJsonObject>();
+	FJsonObjectConverter::UStructToJsonObject(FLODProfile::StaticStruct(), &Profile, ProfileObject);
+	Root->SetObjectField(TEXT("profile"), ProfileObject);
+
+	TSharedRef<FJsonObject> OptionsObject = MakeShared<FJsonObject>();
+	OptionsObject->SetBoolField(TEXT("autoSave"), Options.bAutoSave);
+	OptionsObject->SetBoolField(TEXT("asyncSave"), Options.bAsyncSave);
+	OptionsObject->SetBoolField(TEXT("batchBuild"), Options.bBatchBuild);
+	OptionsObject->SetNumberField(TEXT("maxConcurrentBuilds"), Options.MaxConcurrentBuilds);
+	OptionsObject->SetBoolField(TEXT("skipUnchanged"), Options.bSkipUnchanged);
+	OptionsObject->SetNumberField(TEXT("minTrianglesToProcess"), Options.MinTrianglesToProcess);
+	OptionsObject->SetNumberField(TEXT("maxAssetsPerWindow"), Options.MaxAssetsPerWindow);
+	OptionsObject->SetNumberField(TEXT("memoryBudgetMB"), Options.MemoryBudgetMB);
+	OptionsObject->SetBoolField(TEXT("writeReport"), Options.bWriteReport);
+	OptionsObject->SetStringField(TEXT("profileSource"), Options.ProfileSource);
+	OptionsObject->SetNumberField(TEXT("profileVersion"), Options.ProfileVersion);
+	Root->SetObjectField(TEXT("options"), OptionsObject);
+
+	Root->SetArrayField(TEXT("pending"), PathsToJson(Pending.Array()));
+	Root->SetArrayField(TEXT("completed"), PathsToJson(Completed));
+	Root->SetArrayField(TEXT("failed"), PathsToJson(Failed));
+
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	// Write to a temporary file first so a crash mid-write never corrupts the previous journal.
+	const FString Filename = GetFilename();
+	const FString TempFilename = Filename + TEXT(".tmp");
+	if (!FFileHelper::SaveStringToFile(Output, *TempFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Failed to write job journal %s"), *TempFilename);
+		return false;
+	}
+	return IFileManager::Get().Move(*Filename, *TempFilename, /*bReplace=*/true);
+}
+
+void FLODProfileJobJournal::SaveThrottled(double MinIntervalSeconds, FLODProfilePackageSaver& Saver)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastSaveTime >= MinIntervalSeconds)
+	{
+		LastSaveTime = Now;
+		Saver.Flush();
+		Save();
+	}
+}
+
+bool FLODProfileJobJournal::Load(const FString& JobIdOrFilename, FLODProfileJobJournal& OutJournal)
+{
+	const FString Filename = FPaths::FileExists(JobIdOrFilename)
+		? JobIdOrFilename
+		: FPaths::Combine(GetJournalDirectory(), JobIdOrFilename + TEXT(".json"));
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Filename))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Could not parse job journal %s"), *Filename);
+		return false;
+	}
+
+	FLODProfileJobJournal Journal;
+	FGuid::Parse(Root->GetStringField(TEXT("jobId")), Journal.JobId);
+	FDateTime::ParseIso8601(*Root->GetStringField(TEXT("created")), Journal.CreatedTime);
+	Journal.State = StateFromString(Root->GetStringField(TEXT("state")));
+	Root->TryGetNumberField(TEXT("ownerPid"), Journal.OwnerProcessId);
+	Root->TryGetStringField(TEXT("ownerExecutable"), Journal.OwnerExecutable);
+
+	const TSharedPtr<FJsonObject>* ProfileObject = nullptr;
+	if (!Root->TryGetObjectField(TEXT("profile"), ProfileObject)
+		|| !FJsonObjectConverter::JsonObjectToUStruct(ProfileObject->ToSharedRef(), &Journal.Profile))
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Job journal %s has no valid profile"), *Filename);
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* OptionsObject = nullptr;
+	if (Root->TryGetObjectField(TEXT("options"), OptionsObject))
+	{
+		const FJsonObject& Options = **OptionsObject;
+		Options.TryGetBoolField(TEXT("autoSave"), Journal.Options.bAutoSave);
+		Options.TryGetBoolField(TEXT("asyncSave"), Journal.Options.bAsyncSave);
+		Options.TryGetBoolField(TEXT("batchBuild"), Journal.Options.bBatchBuild);
+		Options.TryGetNumberField(TEXT("maxConcurrentBuilds"), Journal.Options.MaxConcurrentBuilds);
+		Options.TryGetBoolField(TEXT("skipUnchanged"), Journal.Options.bSkipUnchanged);
+		Options.TryGetNumberField(TEXT("minTrianglesToProcess"), Journal.Options.MinTrianglesToProcess);
+		Options.TryGetNumberField(TEXT("maxAssetsPerWindow"), Journal.Options.MaxAssetsPerWindow);
+		Options.TryGetNumberField(TEXT("memoryBudgetMB"), Journal.Options.MemoryBudgetMB);
+		Options.TryGetBoolField(TEXT("writeReport"), Journal.Options.bWriteReport);
+		Options.TryGetStringField(TEXT("profileSource"), Journal.Options.ProfileSource);
+		Options.TryGetNumberField(TEXT("profileVersion"), Journal.Options.ProfileVersion);
+	}
+
+	Journal.Pending.Append(PathsFromJson(Root, TEXT("pending")));
+	Journal.Completed = PathsFromJson(Root, TEXT("completed"));
+	Journal.Failed = PathsFromJson(Root, TEXT("failed"));
+
+	OutJournal = MoveTemp(Journal);
+	return true;
+}
+
+bool FLODProfileJobJournal::FindLatestResumable(FLODProfileJobJournal& OutJournal)
+{
+	TArray<FString> Filenames;
+	IFileManager::Get().FindFiles(Filenames, *FPaths::Combine(GetJournalDirectory(), TEXT("*.json")), /*Files=*/true, /*Directories=*/false);
+
+	bool bFound = false;
+	for (const FString& Name : Filenames)
+	{
+		FLODProfileJobJournal Journal;
+		if (!Load(FPaths::Combine(GetJournalDirectory(), Name), Journal))
+		{
+			continue;
+		}
+		if (Journal.State == ELODProfileJobState::Completed)
+		{
+			// Left by a run that finished before completed journals were deleted on save.
+			Journal.Save();
+			continue;
+		}
+		if (Journal.IsResumable() && (!bFound || Journal.CreatedTime > OutJournal.CreatedTime))
+		{
+			OutJournal = MoveTemp(Journal);
+			bFound = true;
+		}
+	}
+	return bFound;
+}
@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LODProfileTypes.h"
+#include "Misc/Guid.h"
+#include "UObject/SoftObjectPath.h"
+
+class FLODProfilePackageSaver;
+
+/** Lifecycle of a persisted apply job. */
+enum class ELODProfileJobState : uint8
+{
+	Running,
+	Cancelled,
+	Completed
+};
+
+const TCHAR* LexToString(ELODProfileJobState State);
+
+/**
+ * Persisted record of an apply run in Saved/LODProfileTool/Jobs. Tracks which assets are still
+ * pending so a cancelled or crashed run can be resumed instead of restarted.
+ */
+struct FLODProfileJobJournal
+{
+	FGuid JobId;
+	FDateTime CreatedTime;
+	ELODProfileJobState State = ELODProfileJobState::Running;
+
+	/** Process running the job, so a live journal is never mistaken for an interrupted one. */
+	uint32 OwnerProcessId = 0;
+	FString OwnerExecutable;
+
+	FLODProfile Profile;
+	FLODProfileApplyOptions Options;
+
+	TSet<FSoftObjectPath> Pending;
+	TArray<FSoftObjectPath> Completed;
+	TArray<FSoftObjectPath> Failed;
+
+	/** Starts a new journal for the given assets. */
+	static FLODProfileJobJournal Create(const FLODProfile& InProfile, const FLODProfileApplyOptions& InOptions, const TArray<FSoftObjectPath>& InPending);
+
+	void MarkCompleted(const FSoftObjectPath& AssetPath);
+	void MarkFailed(const FSoftObjectPath& AssetPath);
+
+	/** Makes the current process the job's owner, e.g. when it resumes the job. */
+	void ClaimOwnership();
+
+	/**
+	 * True while the job is still running in its owner process, whether this editor session (e.g. a background apply)
+	 * or another editor or commandlet. Process ids are checked against the executable name, since they are recycled.
+	 */
+	bool IsOwnerAlive() const;
+
+	bool IsResumable() const { return State != ELODProfileJobState::Completed && Pending.Num() > 0 && !IsOwnerAlive(); }
+
+	/**
+	 * Writes the journal to its file. A completed job has nothing left to resume, so its file is deleted instead.
+	 * Returns false on I/O failure.
+	 */
+	bool Save() const;
+
+	/**
+	 * Saves when at least MinIntervalSeconds have passed since the last throttled save. Saver is flushed first, so no
+	 * asset reaches the journal as completed while its package write is still queued.
+	 */
+	void SaveThrottled(double MinIntervalSeconds, FLODProfilePackageSaver& Saver);
+
+	FString GetFilename() const;
+
+	/** Loads a journal by job id or file path. */
+	static bool Load(const FString& JobIdOrFilename, FLODProfileJobJournal& OutJournal);
+
+	/** Finds the most recently created journal that still has pending assets and no live owner. Deletes completed journals it finds. */
+	static bool FindLatestResumable(FLODProfileJobJournal& OutJournal);
+
+	static FString GetJournalDirectory();
+
+private:
+	double LastSaveTime = 0.0;
+};
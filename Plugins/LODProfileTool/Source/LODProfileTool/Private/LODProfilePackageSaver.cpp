@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfilePackageSaver.h"
+
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "LODProfileTool.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+FLODProfilePackageSaver::FLODProfilePackageSaver(bool bInAsyncSave)
+	: bAsyncSave(bInAsyncSave)
+{
+}
+
+FLODProfilePackageSaver::~FLODProfilePackageSaver()
+{
+	Flush();
+}
+
+void FLODProfilePackageSaver::CheckOut(const TArray<UPackage*>& Packages)
+{
+	if (Packages.Num() == 0 || !ISourceControlModule::Get().IsEnabled())
+	{
+		return;
+	}
+
+	const ECommandResult::Type Result = FEditorFileUtils::CheckoutPackages(Packages, /*OutPackagesCheckedOut=*/nullptr, /*bErrorIfAlreadyCheckedOut=*/false);
+	if (Result != ECommandResult::Succeeded)
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Source control checkout of %d package(s) did not fully succeed; saving writable packages only."), Packages.Num());
+	}
+}
+
+bool FLODProfilePackageSaver::Save(UPackage* Package)
+{
+	if (!Package)
+	{
+		return false;
+	}
+
+	const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Standalone;
+	SaveArgs.SaveFlags = bAsyncSave ? SAVE_Async : SAVE_None;
+	SaveArgs.Error = GWarn;
+
+	const bool bSuccess = UPackage::SavePackage(Package, nullptr, *Filename, SaveArgs);
+	if (bSuccess)
+	{
+		++NumSaved;
+		bHasPendingWrites |= bAsyncSave;
+	}
+	else
+	{
+		++NumFailed;
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Failed to save package %s"), *Package->GetName());
+	}
+	return bSuccess;
+}
+
+void FLODProfilePackageSaver::Flush()
+{
+	if (bHasPendingWrites)
+	{
+		UPackage::WaitForAsyncFileWrites();
+		bHasPendingWrites = false;
+	}
+}
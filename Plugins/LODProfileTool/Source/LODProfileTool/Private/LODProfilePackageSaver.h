@@ -0,0 +1,39 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPackage;
+
+/**
+ * Saves the packages touched by an apply run. Packages are checked out from source control in a
+ * single batch, then saved one by one as their assets become final. With async saving enabled the
+ * file writes overlap the builds that are still running.
+ */
+class FLODProfilePackageSaver
+{
+public:
+	explicit FLODProfilePackageSaver(bool bInAsyncSave);
+
+	/** Waits for outstanding writes. */
+	~FLODProfilePackageSaver();
+
+	/** Checks out every package in one source control operation. No-op when source control is disabled. */
+	void CheckOut(const TArray<UPackage*>& Packages);
+
+	/** Saves a package whose contents are final. Returns false on failure. */
+	bool Save(UPackage* Package);
+
+	/** Blocks until all async file writes issued by this saver have completed. */
+	void Flush();
+
+	int32 GetNumSaved() const { return NumSaved; }
+	int32 GetNumFailed() const { return NumFailed; }
+
+private:
+	bool bAsyncSave;
+	bool bHasPendingWrites = false;
+	int32 NumSaved = 0;
+	int32 NumFailed = 0;
+};
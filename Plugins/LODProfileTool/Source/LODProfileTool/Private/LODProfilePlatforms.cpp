@@ -0,0 +1,202 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfilePlatforms.h"
+
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "LODProfileApplicator.h"
+#include "PerPlatformProperties.h"
+
+namespace
+{
+	template <typename ValueType>
+	FString DescribeMap(const TMap<FName, ValueType>& Values)
+	{
+		TArray<FString> Entries;
+		for (const TPair<FName, ValueType>& Pair : Values)
+		{
+			Entries.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key.ToString(), *LexToSanitizedString(Pair.Value)));
+		}
+		Entries.Sort();
+		return FString::Join(Entries, TEXT(", "));
+	}
+}
+
+bool FLODProfilePlatforms::HasOverrides(const FLODProfile& Profile)
+{
+	return Profile.PlatformOverrides.Num() > 0 || Profile.QualityLevelMinLODs.Num() > 0;
+}
+
+void FLODProfilePlatforms::ConfigureScreenSize(const FLODProfile& Profile, int32 LODIndex, FPerPlatformFloat& ScreenSize)
+{
+	ScreenSize.Default = FLODProfileApplicator::GetScreenSize(Profile, LODIndex);
+	if (!HasOverrides(Profile))
+	{
+		return;
+	}
+
+	ScreenSize.PerPlatform.Reset();
+	for (const FLODProfilePlatformOverride& Override : Profile.PlatformOverrides)
+	{
+		if (Override.ScreenSizes.IsValidIndex(LODIndex))
+		{
+			ScreenSize.PerPlatform.Add(Override.Platform, FMath::Clamp(Override.ScreenSizes[LODIndex], 0.0f, 1.0f));
+		}
+	}
+}
+
+bool FLODProfilePlatforms::ScreenSizeMatches(const FLODProfile& Profile, int32 LODIndex, const FPerPlatformFloat& ScreenSize)
+{
+	if (!HasOverrides(Profile))
+	{
+		return true;
+	}
+
+	FPerPlatformFloat Expected;
+	ConfigureScreenSize(Profile, LODIndex, Expected);
+	if (Expected.PerPlatform.Num() != ScreenSize.PerPlatform.Num())
+	{
+		return false;
+	}
+	for (const TPair<FName, float>& Pair : Expected.PerPlatform)
+	{
+		const float* Value = ScreenSize.PerPlatform.Find(Pair.Key);
+		if (!Value || !FMath::IsNearlyEqual(*Value, Pair.Value))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+TMap<FName, int32> FLODProfilePlatforms::BuildPlatformMinLODs(const FLODProfile& Profile, int32 NumLODs)
+{
+	TMap<FName, int32> MinLODs;
+	for (const FLODProfilePlatformOverride& Override : Profile.PlatformOverrides)
+	{
+		// An explicit 0 is kept: it lets a platform render LOD0 when the mesh's default minimum LOD is higher.
+		MinLODs.Add(Override.Platform, FMath::Clamp(Override.MinLOD, 0, FMath::Max(0, NumLODs - 1)));
+	}
+	return MinLODs;
+}
+
+TMap<int32, int32> FLODProfilePlatforms::BuildQualityLevelMinLODs(const FLODProfile& Profile, int32 NumLODs)
+{
+	TMap<int32, int32> MinLODs;
+	for (const TPair<EPerQualityLevels, int32>& Pair : Profile.QualityLevelMinLODs)
+	{
+		MinLODs.Add(int32(Pair.Key), FMath::Clamp(Pair.Value, 0, FMath::Max(0, NumLODs - 1)));
+	}
+	return MinLODs;
+}
+
+void FLODProfilePlatforms::ConfigureMinLOD(UStaticMesh* Mesh, const FLODProfile& Profile)
+{
+	const int32 NumLODs = Mesh->GetNumSourceModels();
+
+	FPerPlatformInt MinLOD = Mesh->GetMinLOD();
+	MinLOD.PerPlatform = BuildPlatformMinLODs(Profile, NumLODs);
+	Mesh->SetMinLOD(MoveTemp(MinLOD));
+
+	FPerQualityLevelInt QualityLevelMinLOD = Mesh->GetQualityLevelMinLOD();
+	QualityLevelMinLOD.PerQuality = BuildQualityLevelMinLODs(Profile, NumLODs);
+	Mesh->SetQualityLevelMinLOD(MoveTemp(QualityLevelMinLOD));
+}
+
+void FLODProfilePlatforms::ConfigureMinLOD(USkeletalMesh* Mesh, const FLODProfile& Profile)
+{
+	const int32 NumLODs = Mesh->GetLODNum();
+
+	FPerPlatformInt MinLOD = Mesh->GetMinLod();
+	MinLOD.PerPlatform = BuildPlatformMinLODs(Profile, NumLODs);
+	Mesh->SetMinLod(MoveTemp(MinLOD));
+
+	FPerQualityLevelInt QualityLevelMinLOD = Mesh->GetQualityLevelMinLod();
+	QualityLevelMinLOD.PerQuality = BuildQualityLevelMinLODs(Profile, NumLODs);
+	Mesh->SetQualityLevelMinLod(MoveTemp(QualityLevelMinLOD));
+}
+
+bool FLODProfilePlatforms::MinLODMatches(const UStaticMesh* Mesh, const FLODProfile& Profile)
+{
+	const int32 NumLODs = Mesh->GetNumSourceModels();
+	return Mesh->GetMinLOD().PerPlatform.OrderIndependentCompareEqual(BuildPlatformMinLODs(Profile, NumLODs))
+		&& Mesh->GetQualityLevelMinLOD().PerQuality.OrderIndependentCompareEqual(BuildQualityLevelMinLODs(Profile, NumLODs));
+}
+
+FString FLODProfilePlatforms::Describe(const UStaticMesh* Mesh)
+{
+	TArray<FString> Parts;
+
+	const FPerPlatformInt& MinLOD = Mesh->GetMinLOD();
+	Parts.Add(MinLOD.PerPlatform.Num() > 0
+		? FString::Printf(TEXT("MinLOD %d [%s]"), MinLOD.Default, *DescribeMap(MinLOD.PerPlatform))
+		: FString::Printf(TEXT("MinLOD %d"), MinLOD.Default));
+
+	const FPerQualityLevelInt& QualityLevelMinLOD = Mesh->GetQualityLevelMinLOD();
+	if (QualityLevelMinLOD.PerQuality.Num() > 0)
+	{
+		TMap<FName, int32> ByName;
+		for (const TPair<int32, int32>& Pair : QualityLevelMinLOD.PerQuality)
+		{
+			ByName.Add(FName(StaticEnum<EPerQualityLevels>()->GetNameStringByValue(Pair.Key)), Pair.Value);
+		}
+		Parts.Add(FString::Printf(TEXT("Quality MinLOD %d [%s]"), QualityLevelMinLOD.Default, *DescribeMap(ByName)));
+	}
+
+	for (int32 LODIndex = 0; LODIndex < Mesh->GetNumSourceModels(); ++LODIndex)
+	{
+		const FPerPlatformFloat& ScreenSize = Mesh->GetSourceModel(LODIndex).ScreenSize;
+		if (ScreenSize.PerPlatform.Num() > 0)
+		{
+			Parts.Add(FString::Printf(TEXT("LOD%d screen size [%s]"), LODIndex, *DescribeMap(ScreenSize.PerPlatform)));
+		}
+	}
+	return FString::Join(Parts, TEXT("; "));
+}
+
+bool FLODProfilePlatforms::Validate(const FLODProfile& Profile, FString& OutError)
+{
+	TSet<FName> Platforms;
+	for (const FLODProfilePlatformOverride& Override : Profile.PlatformOverrides)
+	{
+		if (Override.Platform.IsNone())
+		{
+			OutError = TEXT("Every platform override needs a platform or platform group name.");
+			return false;
+		}
+
+		bool bAlreadyInSet = false;
+		Platforms.Add(Override.Platform, &bAlreadyInSet);
+		if (bAlreadyInSet)
+		{
+			OutError = FString::Printf(TEXT("Platform %s is overridden more than once."), *Override.Platform.ToString());
+			return false;
+		}
+
+		if (Override.MinLOD < 0 || Override.MinLOD >= Profile.NumLODs)
+		{
+			OutError = FString::Printf(TEXT("Min LOD of platform %s must be between 0 and %d."), *Override.Platform.ToString(), Profile.NumLODs - 1);
+			return false;
+		}
+
+		for (int32 Index = 0; Index < Override.ScreenSizes.Num(); ++Index)
+		{
+			if (Override.ScreenSizes[Index] < 0.0f || Override.ScreenSizes[Index] > 1.0f)
+			{
+				OutError = FString::Printf(TEXT("Screen size at index %d of platform %s is out of range [0,1]."), Index, *Override.Platform.ToString());
+				return false;
+			}
+		}
+	}
+
+	for (const TPair<EPerQualityLevels, int32>& Pair : Profile.QualityLevelMinLODs)
+	{
+		if (Pair.Value < 0 || Pair.Value >= Profile.NumLODs)
+		{
+			OutError = FString::Printf(TEXT("Min LOD of quality level %s must be between 0 and %d."),
+				*StaticEnum<EPerQualityLevels>()->GetNameStringByValue(int64(Pair.Key)), Profile.NumLODs - 1);
+			return false;
+		}
+	}
+	return true;
+}
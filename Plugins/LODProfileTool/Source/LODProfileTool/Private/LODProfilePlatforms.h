@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LODProfileTypes.h"
+
+class USkeletalMesh;
+class UStaticMesh;
+struct FPerPlatformFloat;
+
+/**
+ * Writes a profile's platform overrides and quality-level minimum LODs into the engine's per-platform and
+ * per-quality-level mesh properties, and checks whether a mesh already carries them.
+ */
+class FLODProfilePlatforms
+{
+public:
+	/** True when the profile sets anything per platform or quality level. */
+	static bool HasOverrides(const FLODProfile& Profile);
+
+	/**
+	 * Sets the default screen size of a LOD and, when the profile has overrides, replaces its per-platform entries with
+	 * the profile's. Without overrides, hand-authored per-platform entries are kept.
+	 */
+	static void ConfigureScreenSize(const FLODProfile& Profile, int32 LODIndex, FPerPlatformFloat& ScreenSize);
+
+	/**
+	 * True when the per-platform entries of a LOD's screen size are exactly the profile's, or the profile has no
+	 * overrides. The default is not compared.
+	 */
+	static bool ScreenSizeMatches(const FLODProfile& Profile, int32 LODIndex, const FPerPlatformFloat& ScreenSize);
+
+	/**
+	 * Replaces the mesh's per-platform and per-quality-level minimum LODs with the profile's, clamped to its LOD count.
+	 * The mesh's default minimum LOD is kept.
+	 */
+	static void ConfigureMinLOD(UStaticMesh* Mesh, const FLODProfile& Profile);
+	static void ConfigureMinLOD(USkeletalMesh* Mesh, const FLODProfile& Profile);
+
+	/** True when ConfigureMinLOD would not change the mesh. */
+	static bool MinLODMatches(const UStaticMesh* Mesh, const FLODProfile& Profile);
+
+	/** Human-readable per-platform and per-quality-level values of a built mesh, e.g. for audits run on a build agent. */
+	static FString Describe(const UStaticMesh* Mesh);
+
+	/** Checks platform names, screen size ranges and minimum LODs. */
+	static bool Validate(const FLODProfile& Profile, FString& OutError);
+
+private:
+	/** Per-platform minimum LODs of the profile, clamped so every platform keeps at least one LOD. */
+	static TMap<FName, int32> BuildPlatformMinLODs(const FLODProfile& Profile, int32 NumLODs);
+
+	/** Per-quality-level minimum LODs of the profile keyed like FPerQualityLevelInt, clamped the same way. */
+	static TMap<int32, int32> BuildQualityLevelMinLODs(const FLODProfile& Profile, int32 NumLODs);
+};
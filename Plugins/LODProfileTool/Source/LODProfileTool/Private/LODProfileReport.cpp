@@ -0,0 +1,259 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileReport.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	template <typename ValueType>
+	TArray<TSharedPtr<FJsonValue>> ToJsonNumbers(const TArray<ValueType>& Values)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonValues;
+		JsonValues.Reserve(Values.Num());
+		for (const ValueType Value : Values)
+		{
+			JsonValues.Add(MakeShared<FJsonValueNumber>(double(Value)));
+		}
+		return JsonValues;
+	}
+
+	TArray<int32> FromJsonArray(const FJsonObject& Object, const TCHAR* Field)
+	{
+		TArray<int32> Values;
+		const TArray<TSharedPtr<FJsonValue>>* JsonValues = nullptr;
+		if (Object.TryGetArrayField(Field, JsonValues))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *JsonValues)
+			{
+				Values.Add(static_cast<int32>(Value->AsNumber()));
+			}
+		}
+		return Values;
+	}
+}
+
+const TCHAR* LexToString(ELODProfileAssetStatus Status)
+{
+	switch (Status)
+	{
+	case ELODProfileAssetStatus::Applied: return TEXT("Applied");
+	case ELODProfileAssetStatus::Skipped: return TEXT("Skipped");
+	case ELODProfileAssetStatus::Failed:  return TEXT("Failed");
+	}
+	return TEXT("Unknown");
+}
+
+int32 FLODProfileApplyReport::AddAsset(const FSoftObjectPath& AssetPath)
+{
+	FLODProfileAssetReport& Entry = Assets.AddDefaulted_GetRef();
+	Entry.AssetPath = AssetPath;
+	return Assets.Num() - 1;
+}
+
+int32 FLODProfileApplyReport::CountWithStatus(ELODProfileAssetStatus Status) const
+{
+	int32 Count = 0;
+	for (const FLODProfileAssetReport& Entry : Assets)
+	{
+		Count += Entry.Status == Status ? 1 : 0;
+	}
+	return Count;
+}
+
+FString FLODProfileApplyReport::ToJsonString() const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("totalSeconds"), TotalSeconds);
+	Root->SetNumberField(TEXT("peakUsedMemoryMB"), PeakUsedMemoryMB);
+	Root->SetNumberField(TEXT("numAssets"), Assets.Num());
+	Root->SetNumberField(TEXT("numApplied"), CountWithStatus(ELODProfileAssetStatus::Applied));
+	Root->SetNumberField(TEXT("numSkipped"), CountWithStatus(ELODProfileAssetStatus::Skipped));
+	Root->SetNumberField(TEXT("numFailed"), CountWithStatus(ELODProfileAssetStatus::Failed));
+	if (FLODProfileDDCStats::IsAvailable())
+	{
+		Root->SetNumberField(TEXT("ddcHits"), DDC.Hits);
+		Root->SetNumberField(TEXT("ddcMisses"), DDC.Misses);
+		Root->SetNumberField(TEXT("ddcHitMB"), DDC.HitMB);
+		Root->SetNumberField(TEXT("ddcHitRate"), DDC.GetHitRate());
+	}
+
+	TArray<TSharedPtr<FJsonValue>> AssetValues;
+	AssetValues.Reserve(Assets.Num());
+	for (const FLODProfileAssetReport& Entry : Assets)
+	{
+		TSharedRef<FJsonObject> AssetObject = MakeShared<FJsonObject>();
+		AssetObject->SetStringField(TEXT("path"), Entry.AssetPath.ToString());
+		AssetObject->SetStringField(TEXT("status"), LexToString(Entry.Status));
+		AssetObject->SetNumberField(TEXT("seconds"), Entry.Seconds);
+		AssetObject->SetNumberField(TEXT("loadMs"), Entry.LoadMs);
+		AssetObject->SetNumberField(TEXT("editMs"), Entry.EditMs);
+		AssetObject->SetNumberField(TEXT("buildMs"), Entry.BuildMs);
+		AssetObject->SetNumberField(TEXT("saveMs"), Entry.SaveMs);
+		AssetObject->SetArrayField(TEXT("trianglesBefore"), FLODProfileReportFiles::ToJsonArray(Entry.TrianglesBefore));
+		AssetObject->SetArrayField(TEXT("trianglesAfter"), FLODProfileReportFiles::ToJsonArray(Entry.TrianglesAfter));
+		AssetObject->SetNumberField(TEXT("usedMemoryMB"), Entry.UsedMemoryMB);
+		if (!Entry.Message.IsEmpty())
+		{
+			AssetObject->SetStringField(TEXT("message"), Entry.Message);
+		}
+		AssetValues.Add(MakeShared<FJsonValueObject>(AssetObject));
+	}
+	Root->SetArrayField(TEXT("assets"), AssetValues);
+
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Output;
+}
+
+bool FLODProfileApplyReport::SaveToFile(const FString& Filename) const
+{
+	return FFileHelper::SaveStringToFile(ToJsonString(), *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+bool FLODProfileApplyReport::LoadFromFile(const FString& Filename, FLODProfileApplyReport& OutReport)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Filename))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		return false;
+	}
+
+	OutReport = FLODProfileApplyReport();
+	Root->TryGetNumberField(TEXT("totalSeconds"), OutReport.TotalSeconds);
+	Root->TryGetNumberField(TEXT("peakUsedMemoryMB"), OutReport.PeakUsedMemoryMB);
+	Root->TryGetNumberField(TEXT("ddcHits"), OutReport.DDC.Hits);
+	Root->TryGetNumberField(TEXT("ddcMisses"), OutReport.DDC.Misses);
+	Root->TryGetNumberField(TEXT("ddcHitMB"), OutReport.DDC.HitMB);
+
+	const TArray<TSharedPtr<FJsonValue>>* AssetValues = nullptr;
+	if (Root->TryGetArrayField(TEXT("assets"), AssetValues))
+	{
+		for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValues)
+		{
+			const TSharedPtr<FJsonObject> AssetObject = AssetValue->AsObject();
+			if (!AssetObject.IsValid())
+			{
+				continue;
+			}
+
+			FLODProfileAssetReport& Entry = OutReport.Assets[OutReport.AddAsset(FSoftObjectPath(AssetObject->GetStringField(TEXT("path"))))];
+			const FString Status = AssetObject->GetStringField(TEXT("status"));
+			for (const ELODProfileAssetStatus Candidate : { ELODProfileAssetStatus::Applied, ELODProfileAssetStatus::Skipped, ELODProfileAssetStatus::Failed })
+			{
+				if (Status == LexToString(Candidate))
+				{
+					Entry.Status = Candidate;
+				}
+			}
+			AssetObject->TryGetNumberField(TEXT("seconds"), Entry.Seconds);
+			AssetObject->TryGetNumberField(TEXT("loadMs"), Entry.LoadMs);
+			AssetObject->TryGetNumberField(TEXT("editMs"), Entry.EditMs);
+			AssetObject->TryGetNumberField(TEXT("buildMs"), Entry.BuildMs);
+			AssetObject->TryGetNumberField(TEXT("saveMs"), Entry.SaveMs);
+			Entry.TrianglesBefore = FromJsonArray(*AssetObject, TEXT("trianglesBefore"));
+			Entry.TrianglesAfter = FromJsonArray(*AssetObject, TEXT("trianglesAfter"));
+			AssetObject->TryGetNumberField(TEXT("usedMemoryMB"), Entry.UsedMemoryMB);
+			AssetObject->TryGetStringField(TEXT("message"), Entry.Message);
+		}
+	}
+	return true;
+}
+
+void FLODProfileApplyReport::Merge(const FLODProfileApplyReport& Other)
+{
+	Assets.Append(Other.Assets);
+	PeakUsedMemoryMB = FMath::Max(PeakUsedMemoryMB, Other.PeakUsedMemoryMB);
+	DDC += Other.DDC;
+}
+
+FString FLODProfileApplyReport::ToCsvString() const
+{
+	FString Output = TEXT("Path,Status,Seconds,LoadMs,EditMs,BuildMs,SaveMs,TrianglesBefore,TrianglesAfter,UsedMemoryMB,Message\n");
+	for (const FLODProfileAssetReport& Entry : Assets)
+	{
+		Output += FString::Printf(TEXT("%s,%s,%.4f,%.2f,%.2f,%.2f,%.2f,%s,%s,%.1f,\"%s\"\n"),
+			*Entry.AssetPath.ToString(),
+			LexToString(Entry.Status),
+			Entry.Seconds,
+			Entry.LoadMs,
+			Entry.EditMs,
+			Entry.BuildMs,
+			Entry.SaveMs,
+			*FLODProfileReportFiles::JoinCounts(Entry.TrianglesBefore),
+			*FLODProfileReportFiles::JoinCounts(Entry.TrianglesAfter),
+			Entry.UsedMemoryMB,
+			*Entry.Message.Replace(TEXT("\""), TEXT("'")));
+	}
+	return Output;
+}
+
+bool FLODProfileApplyReport::SaveCsvToFile(const FString& Filename) const
+{
+	return FFileHelper::SaveStringToFile(ToCsvString(), *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+FString FLODProfileApplyReport::SaveToDefaultLocation(const FString& Name) const
+{
+	return FLODProfileReportFiles::SaveToDefaultLocation(Name, ToJsonString(), ToCsvString());
+}
+
+FString FLODProfileApplyReport::GetDefaultReportDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("LODProfileTool"), TEXT("Reports"));
+}
+
+TArray<TSharedPtr<FJsonValue>> FLODProfileReportFiles::ToJsonArray(const TArray<int32>& Values)
+{
+	return ToJsonNumbers(Values);
+}
+
+TArray<TSharedPtr<FJsonValue>> FLODProfileReportFiles::ToJsonArray(const TArray<int64>& Values)
+{
+	return ToJsonNumbers(Values);
+}
+
+TArray<TSharedPtr<FJsonValue>> FLODProfileReportFiles::ToJsonArray(const TArray<float>& Values)
+{
+	return ToJsonNumbers(Values);
+}
+
+FString FLODProfileReportFiles::JoinCounts(const TArray<int32>& Values)
+{
+	return FString::JoinBy(Values, TEXT(";"), [](int32 Value) { return LexToString(Value); });
+}
+
+FString FLODProfileReportFiles::JoinCounts(const TArray<int64>& Values)
+{
+	return FString::JoinBy(Values, TEXT(";"), [](int64 Value) { return LexToString(Value); });
+}
+
+double FLODProfileReportFiles::ToMB(int64 Bytes)
+{
+	return double(Bytes) / (1024.0 * 1024.0);
+}
+
+bool FLODProfileReportFiles::SaveToFile(const FString& JsonFilename, const FString& Json, const FString& Csv)
+{
+	return FFileHelper::SaveStringToFile(Json, *JsonFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+		&& FFileHelper::SaveStringToFile(Csv, *FPaths::ChangeExtension(JsonFilename, TEXT("csv")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+FString FLODProfileReportFiles::SaveToDefaultLocation(const FString& Name, const FString& Json, const FString& Csv)
+{
+	const FString JsonPath = FPaths::Combine(FLODProfileApplyReport::GetDefaultReportDirectory(), Name + TEXT(".json"));
+	SaveToFile(JsonPath, Json, Csv);
+	return JsonPath;
+}
@@ -0,0 +1,116 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LODProfileDDCStats.h"
+#include "UObject/SoftObjectPath.h"
+
+class FJsonValue;
+
+/** Outcome of applying a profile to a single asset. */
+enum class ELODProfileAssetStatus : uint8
+{
+	Applied,
+	Skipped,
+	Failed
+};
+
+const TCHAR* LexToString(ELODProfileAssetStatus Status);
+
+/**
+ * Result of applying a profile to a single asset.
+ */
+struct FLODProfileAssetReport
+{
+	FSoftObjectPath AssetPath;
+	ELODProfileAssetStatus Status = ELODProfileAssetStatus::Failed;
+
+	/** Wall-clock seconds spent on this asset, including its build latency. */
+	double Seconds = 0.0;
+
+	/** Per-stage wall-clock milliseconds. Reduction runs inside the build, so BuildMs includes it. */
+	double LoadMs = 0.0;
+	double EditMs = 0.0;
+	double BuildMs = 0.0;
+	double SaveMs = 0.0;
+
+	/** Triangles per LOD of the built render data before and after applying the profile. */
+	TArray<int32> TrianglesBefore;
+	TArray<int32> TrianglesAfter;
+
+	/** Process physical memory in MB once the asset was finished. */
+	double UsedMemoryMB = 0.0;
+
+	/** Optional reason for skips and failures. */
+	FString Message;
+};
+
+/**
+ * Per-asset results of an apply run, serializable as a machine-readable summary.
+ */
+struct FLODProfileApplyReport
+{
+	TArray<FLODProfileAssetReport> Assets;
+
+	/** Wall-clock seconds for the whole run. */
+	double TotalSeconds = 0.0;
+
+	/** Peak process physical memory in MB observed at the end of the run. */
+	double PeakUsedMemoryMB = 0.0;
+
+	/** Mesh render data fetched from versus built past the derived data cache during the run. */
+	FLODProfileDDCStats DDC;
+
+	/** Adds an entry for the asset and returns its index. */
+	int32 AddAsset(const FSoftObjectPath& AssetPath);
+
+	int32 CountWithStatus(ELODProfileAssetStatus Status) const;
+
+	/** Serializes the summary and every asset entry to JSON. */
+	FString ToJsonString() const;
+
+	/** Writes the JSON summary to disk. Returns false on I/O failure. */
+	bool SaveToFile(const FString& Filename) const;
+
+	/** Reads a JSON summary written by SaveToFile, e.g. by a worker process. */
+	static bool LoadFromFile(const FString& Filename, FLODProfileApplyReport& OutReport);
+
+	/** Appends the other report's assets and combines its memory peak and cache statistics. TotalSeconds is left alone. */
+	void Merge(const FLODProfileApplyReport& Other);
+
+	/** One row per asset with stage timings and triangle counts, for spreadsheets. */
+	FString ToCsvString() const;
+
+	/** Writes the CSV table to disk. Returns false on I/O failure. */
+	bool SaveCsvToFile(const FString& Filename) const;
+
+	/** Writes Name.json and Name.csv into the default report directory. Returns the JSON path. */
+	FString SaveToDefaultLocation(const FString& Name) const;
+
+	/** Default directory for reports: Saved/LODProfileTool/Reports. */
+	static FString GetDefaultReportDirectory();
+};
+
+/**
+ * Serialization helpers shared by the apply, audit and estimate reports.
+ */
+class FLODProfileReportFiles
+{
+public:
+	static TArray<TSharedPtr<FJsonValue>> ToJsonArray(const TArray<int32>& Values);
+	static TArray<TSharedPtr<FJsonValue>> ToJsonArray(const TArray<int64>& Values);
+	static TArray<TSharedPtr<FJsonValue>> ToJsonArray(const TArray<float>& Values);
+
+	/** Joins per-LOD values with semicolons for a single CSV cell. */
+	static FString JoinCounts(const TArray<int32>& Values);
+	static FString JoinCounts(const TArray<int64>& Values);
+
+	static double ToMB(int64 Bytes);
+
+	/** Writes the JSON to the file and the CSV next to it with a .csv extension. Returns false on I/O failure. */
+	static bool SaveToFile(const FString& JsonFilename, const FString& Json, const FString& Csv);
+
+	/** Writes Name.json and Name.csv into the default report directory. Returns the JSON path. */
+	static FString SaveToDefaultLocation(const FString& Name, const FString& Json, const FString& Csv);
+};
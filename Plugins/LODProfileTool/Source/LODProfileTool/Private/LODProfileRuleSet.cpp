@@ -0,0 +1,317 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileRuleSet.h"
+
+#include "LODProfileApplicator.h"
+#include "LODProfileAsset.h"
+#include "LODProfileAssetFilter.h"
+#include "LODProfileTool.h"
+#include "LODProfileToolSettings.h"
+
+const FName FLODProfileRuleSet::FallbackProfileName(TEXT("Default"));
+
+namespace
+{
+	/** Static mesh registry tag holding the rounded bounding box size as "XxYxZ". */
+	const FName ApproxSizeTag(TEXT("ApproxSize"));
+
+	bool HasWildcard(const FString& Text)
+	{
+		int32 Index;
+		return Text.FindChar(TEXT('*'), Index) || Text.FindChar(TEXT('?'), Index);
+	}
+
+	/** Largest bounding box dimension from the ApproxSize tag, or a negative value when the tag is missing. */
+	float GetApproxBoundsSize(const FAssetData& AssetData)
+	{
+		FString ApproxSize;
+		if (!AssetData.GetTagValue(ApproxSizeTag, ApproxSize))
+		{
+			return -1.0f;
+		}
+
+		TArray<FString> Dimensions;
+		ApproxSize.ParseIntoArray(Dimensions, TEXT("x"));
+		float Largest = -1.0f;
+		for (const FString& Dimension : Dimensions)
+		{
+			Largest = FMath::Max(Largest, FCString::Atof(*Dimension));
+		}
+		return Largest;
+	}
+}
+
+FLODProfileRuleSet FLODProfileRuleSet::Compile(const TArray<FLODProfileRule>& SourceRules, const TMap<FName, FLODProfile>& InProfiles, const FLODProfile* FallbackProfile)
+{
+	FLODProfileRuleSet RuleSet;
+	RuleSet.Profiles = InProfiles;
+	if (FallbackProfile)
+	{
+		RuleSet.Profiles.Add(FallbackProfileName, *FallbackProfile);
+		RuleSet.bHasFallback = true;
+	}
+
+	for (const FLODProfileRule& Source : SourceRules)
+	{
+		if (!InProfiles.Contains(Source.ProfileName))
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("Ignoring LOD profile rule for unknown profile '%s'."), *Source.ProfileName.ToString());
+			continue;
+		}
+
+		FCompiledRule Rule;
+		Rule.ProfileName = Source.ProfileName;
+		Rule.NamePrefix = Source.NamePrefix;
+		Rule.MinBoundsSize = Source.MinBoundsSize;
+		Rule.MaxBoundsSize = Source.MaxBoundsSize;
+		Rule.MinTriangles = Source.MinTriangles;
+		Rule.MaxTriangles = Source.MaxTriangles;
+		Rule.RequiredTags = Source.RequiredTags;
+
+		// A glob without wildcards names a folder and everything below it.
+		FString Glob = Source.PathGlob;
+		Glob.TrimStartAndEndInline();
+		if (!Glob.IsEmpty() && !HasWildcard(Glob))
+		{
+			Glob.RemoveFromEnd(TEXT("/"));
+			Glob += TEXT("/*");
+		}
+		Rule.PackageGlob = Glob;
+
+		const int32 RuleIndex = RuleSet.Rules.Add(MoveTemp(Rule));
+		const FCompiledRule& Added = RuleSet.Rules[RuleIndex];
+
+		FString LiteralFolder;
+		if (!Added.PackageGlob.IsEmpty())
+		{
+			int32 WildcardIndex = Added.PackageGlob.Len();
+			for (int32 Index = 0; Index < Added.PackageGlob.Len(); ++Index)
+			{
+				if (Added.PackageGlob[Index] == TEXT('*') || Added.PackageGlob[Index] == TEXT('?'))
+				{
+					WildcardIndex = Index;
+					break;
+				}
+			}
+			const FString Literal = Added.PackageGlob.Left(WildcardIndex);
+			int32 SlashIndex;
+			if (Literal.FindLastChar(TEXT('/'), SlashIndex) && SlashIndex > 0)
+			{
+				LiteralFolder = Literal.Left(SlashIndex);
+			}
+		}
+
+		if (!LiteralFolder.IsEmpty())
+		{
+			RuleSet.RulesByFolder.FindOrAdd(FName(*LiteralFolder)).Add(RuleIndex);
+		}
+		else if (!Added.NamePrefix.IsEmpty())
+		{
+			RuleSet.RulesByNamePrefix.FindOrAdd(Added.NamePrefix).Add(RuleIndex);
+			RuleSet.NamePrefixLengths.AddUnique(Added.NamePrefix.Len());
+		}
+		else
+		{
+			RuleSet.UnindexedRules.Add(RuleIndex);
+		}
+	}
+
+	RuleSet.NamePrefixLengths.Sort();
+	return RuleSet;
+}
+
+FLODProfileRuleSet FLODProfileRuleSet::FromSettings()
+{
+	const ULODProfileToolSettings* Settings = ULODProfileToolSettings::Get();
+
+	TMap<FName, FLODProfile> Profiles;
+	for (const TPair<FName, FLODProfile>& Pair : Settings->NamedProfiles)
+	{
+		FLODProfile Profile = Pair.Value;
+		ULODProfileToolSettings::SanitizeProfile(Profile);
+
+		FString Error;
+		if (!FLODProfileApplicator::ValidateProfile(Profile, Error))
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("Ignoring named LOD profile '%s': %s"), *Pair.Key.ToString(), *Error);
+			continue;
+		}
+		Profiles.Add(Pair.Key, MoveTemp(Profile));
+	}
+
+	// Library assets are only loaded when a rule names them.
+	TSet<FName> RuleProfileNames;
+	for (const FLODProfileRule& Rule : Settings->ProfileRules)
+	{
+		RuleProfileNames.Add(Rule.ProfileName);
+	}
+
+	TMap<FName, TPair<FString, int32>> AssetSources;
+	for (const FAssetData& LibraryAsset : ULODProfileAsset::GatherLibrary())
+	{
+		if (!RuleProfileNames.Contains(LibraryAsset.AssetName))
+		{
+			continue;
+		}
+		if (Profiles.Contains(LibraryAsset.AssetName))
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("Named LOD profile '%s' shadows profile asset %s."), *LibraryAsset.AssetName.ToString(), *LibraryAsset.GetObjectPathString());
+			continue;
+		}
+
+		const ULODProfileAsset* ProfileAsset = Cast<ULODProfileAsset>(LibraryAsset.GetAsset());
+		if (!ProfileAsset)
+		{
+			continue;
+		}
+
+		FLODProfile Profile = ProfileAsset->GetSanitizedProfile();
+		FString Error;
+		if (!FLODProfileApplicator::ValidateProfile(Profile, Error))
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("Ignoring LOD profile asset %s: %s"), *LibraryAsset.GetObjectPathString(), *Error);
+			continue;
+		}
+		Profiles.Add(LibraryAsset.AssetName, MoveTemp(Profile));
+		AssetSources.Add(LibraryAsset.AssetName, TPair<FString, int32>(LibraryAsset.GetObjectPathString(), ProfileAsset->Version));
+	}
+
+	const FLODProfile DefaultProfile = Settings->BuildProfile();
+	FLODProfileRuleSet RuleSet = Compile(Settings->ProfileRules, Profiles, Settings->bApplyDefaultProfileToUnmatched ? &DefaultProfile : nullptr);
+	RuleSet.AssetSources = MoveTemp(AssetSources);
+	return RuleSet;
+}
+
+FName FLODProfileRuleSet::FindProfileName(const FAssetData& AssetData) const
+{
+	TArray<int32, TInlineAllocator<16>> Candidates(UnindexedRules);
+
+	// Walk up the package folders; FNAME_Find avoids adding every visited folder to the name table.
+	FString Folder = AssetData.PackagePath.ToString();
+	while (!Folder.IsEmpty())
+	{
+		const FName FolderName(*Folder, FNAME_Find);
+		if (!FolderName.IsNone())
+		{
+			if (const TArray<int32>* FolderRules = RulesByFolder.Find(FolderName))
+			{
+				Candidates.Append(*FolderRules);
+			}
+		}
+
+		int32 SlashIndex;
+		if (!Folder.FindLastChar(TEXT('/'), SlashIndex) || SlashIndex == 0)
+		{
+			break;
+		}
+		Folder.LeftInline(SlashIndex);
+	}
+
+	if (NamePrefixLengths.Num() > 0)
+	{
+		const FString AssetName = AssetData.AssetName.ToString();
+		for (const int32 Length : NamePrefixLengths)
+		{
+			if (Length > AssetName.Len())
+			{
+				break;
+			}
+			if (const TArray<int32>* PrefixRules = RulesByNamePrefix.Find(AssetName.Left(Length)))
+			{
+				Candidates.Append(*PrefixRules);
+			}
+		}
+	}
+
+	// Earlier rules take priority, as in the settings table.
+	Candidates.Sort();
+	for (const int32 RuleIndex : Candidates)
+	{
+		const FCompiledRule& Rule = Rules[RuleIndex];
+		if (Matches(Rule, AssetData))
+		{
+			return Rule.ProfileName;
+		}
+	}
+	return bHasFallback ? FallbackProfileName : NAME_None;
+}
+
+const FLODProfile* FLODProfileRuleSet::FindProfile(FName Name) const
+{
+	return Profiles.Find(Name);
+}
+
+void FLODProfileRuleSet::GetProfileSource(FName Name, FString& OutSource, int32& OutVersion) const
+{
+	if (const TPair<FString, int32>* AssetSource = AssetSources.Find(Name))
+	{
+		OutSource = AssetSource->Key;
+		OutVersion = AssetSource->Value;
+		return;
+	}
+	OutSource = Name.ToString();
+	OutVersion = 0;
+}
+
+TMap<FName, TArray<FAssetData>> FLODProfileRuleSet::Partition(const TArray<FAssetData>& Assets, TArray<FAssetData>& OutUnmatched) const
+{
+	TMap<FName, TArray<FAssetData>> Groups;
+	for (const FAssetData& AssetData : Assets)
+	{
+		const FName ProfileName = FindProfileName(AssetData);
+		if (ProfileName.IsNone())
+		{
+			OutUnmatched.Add(AssetData);
+		}
+		else
+		{
+			Groups.FindOrAdd(ProfileName).Add(AssetData);
+		}
+	}
+	return Groups;
+}
+
+bool FLODProfileRuleSet::Matches(const FCompiledRule& Rule, const FAssetData& AssetData) const
+{
+	if (!Rule.PackageGlob.IsEmpty() && !AssetData.PackageName.ToString().MatchesWildcard(Rule.PackageGlob))
+	{
+		return false;
+	}
+
+	if (!Rule.NamePrefix.IsEmpty() && !AssetData.AssetName.ToString().StartsWith(Rule.NamePrefix))
+	{
+		return false;
+	}
+
+	if (Rule.MinTriangles > 0 || Rule.MaxTriangles > 0)
+	{
+		int32 NumTriangles = INDEX_NONE;
+		if (!AssetData.GetTagValue(FLODProfileAssetFilter::TrianglesTag, NumTriangles)
+			|| (Rule.MinTriangles > 0 && NumTriangles < Rule.MinTriangles)
+			|| (Rule.MaxTriangles > 0 && NumTriangles > Rule.MaxTriangles))
+		{
+			return false;
+		}
+	}
+
+	if (Rule.MinBoundsSize > 0.0f || Rule.MaxBoundsSize > 0.0f)
+	{
+		const float BoundsSize = GetApproxBoundsSize(AssetData);
+		if (BoundsSize < 0.0f
+			|| (Rule.MinBoundsSize > 0.0f && BoundsSize < Rule.MinBoundsSize)
+			|| (Rule.MaxBoundsSize > 0.0f && BoundsSize > Rule.MaxBoundsSize))
+		{
+			return false;
+		}
+	}
+
+	for (const TPair<FName, FString>& RequiredTag : Rule.RequiredTags)
+	{
+		FString Value;
+		if (!AssetData.GetTagValue(RequiredTag.Key, Value) || (RequiredTag.Value != TEXT("*") && Value != RequiredTag.Value))
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "LODProfileTypes.h"
+
+/**
+ * Compiled form of the profile rule table. Rules are indexed by the literal folder of their path glob, or else by
+ * their name prefix, so a lookup only evaluates the rules whose index keys the asset can match; its cost follows the
+ * asset's folder depth and the number of distinct prefix lengths rather than the number of rules.
+ */
+class FLODProfileRuleSet
+{
+public:
+	/** Name under which unmatched meshes are grouped when a fallback profile is set. */
+	static const FName FallbackProfileName;
+
+	/** Compiles the rules. Rules naming an unknown profile are dropped with a warning. FallbackProfile may be null. */
+	static FLODProfileRuleSet Compile(const TArray<FLODProfileRule>& Rules, const TMap<FName, FLODProfile>& Profiles, const FLODProfile* FallbackProfile);
+
+	/** Compiles the rule table from project settings. Rules can name settings profiles or profile library assets by asset name. */
+	static FLODProfileRuleSet FromSettings();
+
+	/** Returns the profile name for the asset from its registry data, or NAME_None when no rule matches and there is no fallback. */
+	FName FindProfileName(const FAssetData& AssetData) const;
+
+	/** Profile registered under Name, or null. */
+	const FLODProfile* FindProfile(FName Name) const;
+
+	/** Groups assets by the profile they resolve to. Assets matching nothing go to OutUnmatched. */
+	TMap<FName, TArray<FAssetData>> Partition(const TArray<FAssetData>& Assets, TArray<FAssetData>& OutUnmatched) const;
+
+	/** Stamp identity for the profile registered under Name: the library asset path and version, or else the profile name. */
+	void GetProfileSource(FName Name, FString& OutSource, int32& OutVersion) const;
+
+	int32 NumRules() const { return Rules.Num(); }
+
+private:
+	struct FCompiledRule
+	{
+		FName ProfileName;
+
+		/** Package name wildcard; empty matches everything. */
+		FString PackageGlob;
+		FString NamePrefix;
+		float MinBoundsSize = 0.0f;
+		float MaxBoundsSize = 0.0f;
+		int32 MinTriangles = 0;
+		int32 MaxTriangles = 0;
+		TMap<FName, FString> RequiredTags;
+	};
+
+	bool Matches(const FCompiledRule& Rule, const FAssetData& AssetData) const;
+
+	TArray<FCompiledRule> Rules;
+
+	/** Rule indices keyed by the literal folder in front of the first wildcard of their glob. */
+	TMap<FName, TArray<int32>> RulesByFolder;
+
+	/** Rule indices keyed by name prefix, for rules without a literal folder. */
+	TMap<FString, TArray<int32>> RulesByNamePrefix;
+
+	/** Distinct lengths in RulesByNamePrefix, ascending. */
+	TArray<int32> NamePrefixLengths;
+
+	/** Rules with neither key; candidates for every asset. */
+	TArray<int32> UnindexedRules;
+
+	TMap<FName, FLODProfile> Profiles;
+	bool bHasFallback = false;
+
+	/** Library asset path and version for profiles loaded from profile assets. */
+	TMap<FName, TPair<FString, int32>> AssetSources;
+};
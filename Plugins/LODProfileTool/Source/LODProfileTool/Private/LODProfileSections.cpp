@@ -0,0 +1,187 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileSections.h"
+
+#include "Engine/StaticMesh.h"
+#include "LODProfileStamp.h"
+#include "LODProfileTool.h"
+#include "MeshDescription.h"
+#include "Misc/EngineVersionComparison.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "StaticMeshAttributes.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+
+bool FLODProfileSections::Apply(UStaticMesh* Mesh, int32 LODIndex, const FLODProfileSectionSettings& Settings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_StripSections);
+
+	const FMeshDescription* SourceDescription = Mesh->GetMeshDescription(0);
+	if (LODIndex <= 0 || !SourceDescription)
+	{
+		return false;
+	}
+
+	FMeshDescription Description = *SourceDescription;
+	FStaticMeshAttributes Attributes(Description);
+	TPolygonGroupAttributesRef<FName> SlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+
+	// Drop matching sections along with the geometry only they used.
+	TArray<FPolygonGroupID> Groups;
+	for (const FPolygonGroupID GroupID : Description.PolygonGroups().GetElementIDs())
+	{
+		if (!MatchesAny(SlotNames[GroupID], Settings.DropMaterialSlots))
+		{
+			Groups.Add(GroupID);
+			continue;
+		}
+
+		TArray<FEdgeID> OrphanedEdges;
+		TArray<FVertexInstanceID> OrphanedVertexInstances;
+		const TArray<FPolygonID> Polygons(Description.GetPolygonGroupPolygonIDs(GroupID));
+		for (const FPolygonID PolygonID : Polygons)
+		{
+			Description.DeletePolygon(PolygonID, &OrphanedEdges, &OrphanedVertexInstances, nullptr);
+		}
+
+		TArray<FVertexID> OrphanedVertices;
+		for (const FVertexInstanceID VertexInstanceID : TSet<FVertexInstanceID>(OrphanedVertexInstances))
+		{
+			Description.DeleteVertexInstance(VertexInstanceID, &OrphanedVertices);
+		}
+		for (const FEdgeID EdgeID : TSet<FEdgeID>(OrphanedEdges))
+		{
+			Description.DeleteEdge(EdgeID, &OrphanedVertices);
+		}
+		for (const FVertexID VertexID : TSet<FVertexID>(OrphanedVertices))
+		{
+			if (Description.IsVertexOrphaned(VertexID))
+			{
+				Description.DeleteVertex(VertexID);
+			}
+		}
+		Description.DeletePolygonGroup(GroupID);
+	}
+
+	if (Groups.Num() == 0)
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("%s LOD%d: every section matches DropMaterialSlots; sections left unchanged."), *Mesh->GetName(), LODIndex);
+		return false;
+	}
+
+	// Largest sections first; everything past the limit is merged into the largest.
+	Groups.StableSort([&Description](const FPolygonGroupID A, const FPolygonGroupID B)
+	{
+		return Description.GetNumPolygonGroupTriangles(A) > Description.GetNumPolygonGroupTriangles(B);
+	});
+	const int32 NumKept = Settings.bMergeSections ? 1 : Settings.MaxSections > 0 ? FMath::Min(Settings.MaxSections, Groups.Num()) : Groups.Num();
+	for (int32 Index = NumKept; Index < Groups.Num(); ++Index)
+	{
+		const TArray<FPolygonID> Polygons(Description.GetPolygonGroupPolygonIDs(Groups[Index]));
+		for (const FPolygonID PolygonID : Polygons)
+		{
+			Description.SetPolygonPolygonGroup(PolygonID, Groups[0]);
+		}
+		Description.DeletePolygonGroup(Groups[Index]);
+	}
+
+	FElementIDRemappings Remappings;
+	Description.Compact(Remappings);
+
+	// Sections follow polygon group order; map each to the material slot its group refers to.
+	FMeshSectionInfoMap& SectionInfoMap = Mesh->GetSectionInfoMap();
+	const int32 NumOldSections = SectionInfoMap.GetSectionNumber(LODIndex);
+	for (int32 SectionIndex = 0; SectionIndex < NumOldSections; ++SectionIndex)
+	{
+		SectionInfoMap.Remove(LODIndex, SectionIndex);
+	}
+	FStaticMeshAttributes CompactedAttributes(Description);
+	TPolygonGroupAttributesConstRef<FName> CompactedSlotNames = CompactedAttributes.GetPolygonGroupMaterialSlotNames();
+	int32 SectionIndex = 0;
+	for (const FPolygonGroupID GroupID : Description.PolygonGroups().GetElementIDs())
+	{
+		const int32 MaterialIndex = Mesh->GetMaterialIndexFromImportedMaterialSlotName(CompactedSlotNames[GroupID]);
+		SectionInfoMap.Set(LODIndex, SectionIndex++, FMeshSectionInfo(FMath::Max(0, MaterialIndex)));
+	}
+
+	Mesh->CreateMeshDescription(LODIndex, MoveTemp(Description));
+	Mesh->CommitMeshDescription(LODIndex);
+
+	// Reduce from the stripped copy rather than from LOD0.
+	Mesh->GetSourceModel(LODIndex).ReductionSettings.BaseLODModel = LODIndex;
+	SetApplied(Mesh, LODIndex, true);
+	return true;
+}
+
+bool FLODProfileSections::IsApplied(const UStaticMesh* Mesh, int32 LODIndex)
+{
+	return LODIndex > 0 && LODIndex < Mesh->GetNumSourceModels() && !FLODProfileStamp::Read(Mesh, GetAppliedKey(LODIndex)).IsEmpty();
+}
+
+void FLODProfileSections::Reset(UStaticMesh* Mesh, int32 LODIndex)
+{
+	if (!IsApplied(Mesh, LODIndex))
+	{
+		return;
+	}
+
+	Mesh->ClearMeshDescription(LODIndex);
+
+	FMeshSectionInfoMap& SectionInfoMap = Mesh->GetSectionInfoMap();
+	const int32 NumOldSections = SectionInfoMap.GetSectionNumber(LODIndex);
+	for (int32 SectionIndex = 0; SectionIndex < NumOldSections; ++SectionIndex)
+	{
+		SectionInfoMap.Remove(LODIndex, SectionIndex);
+	}
+	const int32 NumSourceSections = SectionInfoMap.GetSectionNumber(0);
+	for (int32 SectionIndex = 0; SectionIndex < NumSourceSections; ++SectionIndex)
+	{
+		SectionInfoMap.Set(LODIndex, SectionIndex, SectionInfoMap.Get(0, SectionIndex));
+	}
+
+	Mesh->GetSourceModel(LODIndex).ReductionSettings.BaseLODModel = 0;
+	SetApplied(Mesh, LODIndex, false);
+}
+
+FName FLODProfileSections::GetAppliedKey(int32 LODIndex)
+{
+	return FName(*FString::Printf(TEXT("LODProfileStrippedLOD%d"), LODIndex));
+}
+
+void FLODProfileSections::SetApplied(UStaticMesh* Mesh, int32 LODIndex, bool bApplied)
+{
+#if UE_VERSION_OLDER_THAN(5, 6, 0)
+	UMetaData* MetaData = Mesh->GetOutermost()->GetMetaData();
+	if (bApplied)
+	{
+		MetaData->SetValue(Mesh, GetAppliedKey(LODIndex), TEXT("1"));
+	}
+	else
+	{
+		MetaData->RemoveValue(Mesh, GetAppliedKey(LODIndex));
+	}
+#else
+	FMetaData& MetaData = Mesh->GetOutermost()->GetMetaData();
+	if (bApplied)
+	{
+		MetaData.SetValue(Mesh, GetAppliedKey(LODIndex), TEXT("1"));
+	}
+	else
+	{
+		MetaData.RemoveValue(Mesh, GetAppliedKey(LODIndex));
+	}
+#endif
+}
+
+bool FLODProfileSections::MatchesAny(FName SlotName, const TArray<FString>& Patterns)
+{
+	const FString SlotString = SlotName.ToString();
+	for (const FString& Pattern : Patterns)
+	{
+		if (SlotString.MatchesWildcard(Pattern))
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,43 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LODProfileTypes.h"
+
+class UStaticMesh;
+
+/**
+ * Drops and merges material sections of generated static mesh LODs. The LOD gets its own mesh description, copied from
+ * LOD0 with the requested sections removed or merged, and reduces itself from that copy.
+ */
+class FLODProfileSections
+{
+public:
+	/**
+	 * Writes the stripped copy of LOD0 into the LOD and points its reduction at it. Does not build. Returns false when
+	 * LOD0 has no mesh description or every section would be dropped.
+	 */
+	static bool Apply(UStaticMesh* Mesh, int32 LODIndex, const FLODProfileSectionSettings& Settings);
+
+	/**
+	 * True when the LOD still reduces from a stripped copy written by Apply, as recorded in the package metadata.
+	 * Hand-imported LODs also reduce from their own geometry, but never carry the marker.
+	 */
+	static bool IsApplied(const UStaticMesh* Mesh, int32 LODIndex);
+
+	/**
+	 * Undoes Apply once the profile no longer strips the LOD: drops the stripped copy, copies LOD0's sections and
+	 * reduces from LOD0 again. LODs without the marker are left alone.
+	 */
+	static void Reset(UStaticMesh* Mesh, int32 LODIndex);
+
+private:
+	/** Package metadata key marking a LOD whose geometry Apply wrote. */
+	static FName GetAppliedKey(int32 LODIndex);
+
+	static void SetApplied(UStaticMesh* Mesh, int32 LODIndex, bool bApplied);
+
+	/** True when the slot name matches any of the patterns. */
+	static bool MatchesAny(FName SlotName, const TArray<FString>& Patterns);
+};
@@ -0,0 +1,223 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileShards.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/PlatformProcess.h"
+#include "LODProfileAssetFilter.h"
+#include "LODProfileReport.h"
+#include "LODProfileTool.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** Triangle-equivalent cost of loading, saving and bookkeeping for one asset. */
+	constexpr int64 PerAssetOverheadTriangles = 2000;
+
+	/** Stand-in LOD0 triangle count for meshes without the registry tag. */
+	constexpr int64 UnknownMeshTriangles = 10000;
+
+	/** Seconds between checks on the running workers. */
+	constexpr float WorkerPollSeconds = 1.0f;
+
+	/** Seconds between progress lines while workers run. */
+	constexpr double WorkerLogIntervalSeconds = 30.0;
+}
+
+TArray<TArray<FAssetData>> FLODProfileShards::Partition(const TArray<FAssetData>& Assets, int32 NumShards)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_PartitionShards);
+	NumShards = FMath::Clamp(NumShards, 1, FMath::Max(1, Assets.Num()));
+
+	TArray<TPair<int64, int32>> CostByAsset;
+	CostByAsset.Reserve(Assets.Num());
+	for (int32 Index = 0; Index < Assets.Num(); ++Index)
+	{
+		CostByAsset.Emplace(EstimateCost(Assets[Index]), Index);
+	}
+
+	// Longest processing time first: the most expensive remaining asset goes to the currently cheapest shard.
+	CostByAsset.Sort([](const TPair<int64, int32>& A, const TPair<int64, int32>& B)
+	{
+		return A.Key != B.Key ? A.Key > B.Key : A.Value < B.Value;
+	});
+
+	TArray<TArray<FAssetData>> Shards;
+	Shards.SetNum(NumShards);
+	TArray<int64> ShardCosts;
+	ShardCosts.SetNumZeroed(NumShards);
+	for (const TPair<int64, int32>& Pair : CostByAsset)
+	{
+		int32 Cheapest = 0;
+		for (int32 ShardIndex = 1; ShardIndex < NumShards; ++ShardIndex)
+		{
+			if (ShardCosts[ShardIndex] < ShardCosts[Cheapest])
+			{
+				Cheapest = ShardIndex;
+			}
+		}
+		Shards[Cheapest].Add(Assets[Pair.Value]);
+		ShardCosts[Cheapest] += Pair.Key;
+	}
+
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+	{
+		UE_LOG(LogLODProfileTool, Log, TEXT("Shard %d: %d asset(s), estimated cost %lld."), ShardIndex, Shards[ShardIndex].Num(), ShardCosts[ShardIndex]);
+	}
+	return Shards;
+}
+
+bool FLODProfileShards::Run(const TArray<FAssetData>& Assets, const FLODProfileShardOptions& Options, FLODProfileApplyReport& OutReport)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_RunShards);
+	const double RunStartTime = FPlatformTime::Seconds();
+	const TArray<TArray<FAssetData>> Shards = Partition(Assets, Options.NumWorkers);
+
+	struct FWorker
+	{
+		FProcHandle Process;
+		FString ReportPath;
+		int32 ReturnCode = 0;
+		bool bRunning = false;
+	};
+	TArray<FWorker> Workers;
+	Workers.SetNum(Shards.Num());
+
+	const FString Executable = FPlatformProcess::ExecutablePath();
+	const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+	const FString WorkingDirectory = FPaths::ConvertRelativePathToFull(Options.WorkingDirectory);
+
+	bool bAllLaunched = true;
+	for (int32 ShardIndex = 0; ShardIndex < Shards.Num(); ++ShardIndex)
+	{
+		const FString ShardName = FString::Printf(TEXT("Shard_%d"), ShardIndex);
+		const FString ShardFile = FPaths::Combine(WorkingDirectory, ShardName + TEXT(".txt"));
+		FWorker& Worker = Workers[ShardIndex];
+		Worker.ReportPath = FPaths::Combine(WorkingDirectory, ShardName + TEXT(".json"));
+		if (Shards[ShardIndex].IsEmpty() || !SaveShardFile(ShardFile, Shards[ShardIndex]))
+		{
+			continue;
+		}
+
+		const FString Arguments = FString::Printf(TEXT("\"%s\" -run=LODProfile -ShardFile=\"%s\" -Report=\"%s\" -abslog=\"%s\" %s -unattended -nosplash -nullrhi"),
+			*ProjectPath, *ShardFile, *Worker.ReportPath, *FPaths::Combine(WorkingDirectory, ShardName + TEXT(".log")), *Options.WorkerArguments);
+		Worker.Process = FPlatformProcess::CreateProc(*Executable, *Arguments, /*bLaunchDetached=*/false, /*bLaunchHidden=*/true,
+			/*bLaunchReallyHidden=*/true, nullptr, /*PriorityModifier=*/0, nullptr, nullptr);
+		Worker.bRunning = Worker.Process.IsValid();
+		if (!Worker.bRunning)
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Could not launch LOD profile worker for %s."), *ShardName);
+			bAllLaunched = false;
+			continue;
+		}
+		UE_LOG(LogLODProfileTool, Display, TEXT("Launched worker %d for %d asset(s)."), ShardIndex, Shards[ShardIndex].Num());
+	}
+
+	double LastLogTime = FPlatformTime::Seconds();
+	for (int32 NumRunning = Workers.Num(); NumRunning > 0;)
+	{
+		NumRunning = 0;
+		for (FWorker& Worker : Workers)
+		{
+			if (!Worker.bRunning)
+			{
+				continue;
+			}
+			if (FPlatformProcess::IsProcRunning(Worker.Process))
+			{
+				++NumRunning;
+				continue;
+			}
+			FPlatformProcess::GetProcReturnCode(Worker.Process, &Worker.ReturnCode);
+			FPlatformProcess::CloseProc(Worker.Process);
+			Worker.bRunning = false;
+		}
+
+		if (NumRunning > 0)
+		{
+			if (FPlatformTime::Seconds() - LastLogTime >= WorkerLogIntervalSeconds)
+			{
+				UE_LOG(LogLODProfileTool, Display, TEXT("%d of %d worker(s) still running."), NumRunning, Workers.Num());
+				LastLogTime = FPlatformTime::Seconds();
+			}
+			FPlatformProcess::Sleep(WorkerPollSeconds);
+		}
+	}
+
+	for (int32 ShardIndex = 0; ShardIndex < Shards.Num(); ++ShardIndex)
+	{
+		const FWorker& Worker = Workers[ShardIndex];
+		FLODProfileApplyReport WorkerReport;
+		const bool bHasReport = !Shards[ShardIndex].IsEmpty() && FLODProfileApplyReport::LoadFromFile(Worker.ReportPath, WorkerReport);
+		if (bHasReport)
+		{
+			OutReport.Merge(WorkerReport);
+		}
+
+		// Anything the worker did not report on, e.g. after a crash, is failed so the run does not pass silently.
+		TSet<FSoftObjectPath> Reported;
+		for (const FLODProfileAssetReport& Entry : WorkerReport.Assets)
+		{
+			Reported.Add(Entry.AssetPath);
+		}
+		for (const FAssetData& AssetData : Shards[ShardIndex])
+		{
+			if (!Reported.Contains(AssetData.GetSoftObjectPath()))
+			{
+				FLODProfileAssetReport& Entry = OutReport.Assets[OutReport.AddAsset(AssetData.GetSoftObjectPath())];
+				Entry.Message = FString::Printf(TEXT("Worker %d exited with code %d without reporting the asset"), ShardIndex, Worker.ReturnCode);
+			}
+		}
+		if (!Shards[ShardIndex].IsEmpty() && !bHasReport)
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Worker %d exited with code %d and wrote no report."), ShardIndex, Worker.ReturnCode);
+		}
+	}
+
+	OutReport.TotalSeconds = FPlatformTime::Seconds() - RunStartTime;
+	return bAllLaunched;
+}
+
+bool FLODProfileShards::SaveShardFile(const FString& Filename, const TArray<FAssetData>& Assets)
+{
+	TArray<FString> Lines;
+	Lines.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		Lines.Add(AssetData.GetObjectPathString());
+	}
+	return FFileHelper::SaveStringArrayToFile(Lines, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+bool FLODProfileShards::LoadShardFile(const FString& Filename, TArray<FAssetData>& OutAssets)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Filename))
+	{
+		return false;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	OutAssets.Reserve(Lines.Num());
+	for (const FString& Line : Lines)
+	{
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Line.TrimStartAndEnd()));
+		if (AssetData.IsValid())
+		{
+			OutAssets.Add(AssetData);
+		}
+		else if (!Line.TrimStartAndEnd().IsEmpty())
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("Shard asset %s is no longer in the asset registry."), *Line);
+		}
+	}
+	return true;
+}
+
+int64 FLODProfileShards::EstimateCost(const FAssetData& AssetData)
+{
+	int32 Triangles = INDEX_NONE;
+	AssetData.GetTagValue(FLODProfileAssetFilter::TrianglesTag, Triangles);
+	return (Triangles >= 0 ? int64(Triangles) : UnknownMeshTriangles) + PerAssetOverheadTriangles;
+}
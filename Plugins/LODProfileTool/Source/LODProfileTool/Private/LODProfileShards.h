@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+struct FLODProfileApplyReport;
+
+/** Settings for a run split across local worker processes. */
+struct FLODProfileShardOptions
+{
+	/** Number of worker editor processes, one shard each. */
+	int32 NumWorkers = 2;
+
+	/** Extra commandlet arguments forwarded to every worker, e.g. the profile selection. */
+	FString WorkerArguments;
+
+	/** Directory receiving the shard lists, worker reports and worker logs. */
+	FString WorkingDirectory;
+};
+
+/**
+ * Splits a project-wide apply across headless worker editor processes on the local machine. Each worker runs the
+ * LODProfile commandlet on its shard with its own UObject heap and garbage collector; the coordinator waits for all
+ * of them and merges their reports.
+ */
+class FLODProfileShards
+{
+public:
+	/**
+	 * Splits assets into at most NumShards shards of similar cost. Cost is the LOD0 triangle count from asset registry
+	 * tags plus a fixed per-asset overhead, so a shard of a few dense meshes balances one of many small props.
+	 */
+	static TArray<TArray<FAssetData>> Partition(const TArray<FAssetData>& Assets, int32 NumShards);
+
+	/**
+	 * Partitions the assets, runs one worker per shard and merges the worker reports into OutReport. Assets of a worker
+	 * that exited without a report are recorded as failed. Returns false when a worker could not be launched.
+	 */
+	static bool Run(const TArray<FAssetData>& Assets, const FLODProfileShardOptions& Options, FLODProfileApplyReport& OutReport);
+
+	/** Writes the object paths of a shard, one per line. */
+	static bool SaveShardFile(const FString& Filename, const TArray<FAssetData>& Assets);
+
+	/** Resolves the object paths of a shard file through the asset registry. Paths no longer in the registry are dropped. */
+	static bool LoadShardFile(const FString& Filename, TArray<FAssetData>& OutAssets);
+
+private:
+	/** Estimated processing cost of one asset in triangle units. */
+	static int64 EstimateCost(const FAssetData& AssetData);
+};
@@ -0,0 +1,171 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileSkeletalMesh.h"
+
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkinnedAssetCommon.h"
+#include "Interfaces/ITargetPlatformManagerModule.h"
+#include "LODProfileApplicator.h"
+#include "LODProfilePlatforms.h"
+#include "LODProfileReport.h"
+#include "LODProfileStamp.h"
+#include "LODUtilities.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Rendering/SkeletalMeshLODModel.h"
+#include "Rendering/SkeletalMeshModel.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "SkinnedAssetCompiler.h"
+
+namespace
+{
+	constexpr double MillisecondsPerSecond = 1000.0;
+}
+
+bool FLODProfileSkeletalMesh::Apply(USkeletalMesh* Mesh, const FLODProfile& Profile, const FString& ProfileHash, FLODProfileAssetReport& OutEntry)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_ApplyProfileToSkeletalMesh);
+	if (!Mesh || GetSourceTriangleCount(Mesh) == 0)
+	{
+		OutEntry.Message = TEXT("No source geometry");
+		return false;
+	}
+
+	OutEntry.TrianglesBefore = GetLODTriangleCounts(Mesh);
+
+	const double EditStartTime = FPlatformTime::Seconds();
+	const int32 ExistingLODCount = Mesh->GetLODNum();
+	const int32 TargetLODCount = Profile.bOverrideExisting ? Profile.NumLODs : FMath::Max(ExistingLODCount, Profile.NumLODs);
+	Mesh->Modify();
+	while (Mesh->GetLODNum() < TargetLODCount)
+	{
+		Mesh->AddLODInfo();
+	}
+	ConfigureLODInfos(Mesh, Profile, ExistingLODCount);
+	const double BuildStartTime = FPlatformTime::Seconds();
+	OutEntry.EditMs = (BuildStartTime - EditStartTime) * MillisecondsPerSecond;
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_RegenerateSkeletalLODs);
+		// Drops LODs past the target count. Imported LODs are only re-reduced when the profile overrides existing LODs.
+		const ITargetPlatform* TargetPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform();
+		FLODUtilities::RegenerateLOD(Mesh, TargetPlatform, TargetLODCount, /*bRegenerateEvenIfImported=*/Profile.bOverrideExisting, /*bGenerateBaseLOD=*/false);
+	}
+	OutEntry.TrianglesAfter = GetLODTriangleCounts(Mesh);
+	OutEntry.BuildMs = (FPlatformTime::Seconds() - BuildStartTime) * MillisecondsPerSecond;
+
+	FLODProfileStamp::Write(Mesh, ProfileHash);
+	Mesh->MarkPackageDirty();
+	return true;
+}
+
+TArray<int32> FLODProfileSkeletalMesh::GetLODTriangleCounts(USkeletalMesh* Mesh)
+{
+	FSkinnedAssetCompilingManager::Get().FinishCompilation({Mesh});
+
+	TArray<int32> Counts;
+	if (const FSkeletalMeshRenderData* RenderData = Mesh->GetResourceForRendering())
+	{
+		for (const FSkeletalMeshLODRenderData& LODRenderData : RenderData->LODRenderData)
+		{
+			Counts.Add(int32(LODRenderData.GetTotalFaces()));
+		}
+	}
+	return Counts;
+}
+
+void FLODProfileSkeletalMesh::ConfigureLODInfos(USkeletalMesh* Mesh, const FLODProfile& Profile, int32 ExistingLODCount)
+{
+	const FLODProfileSkeletalSettings& Settings = Profile.Skeletal;
+	const int32 SourceTriangles = GetSourceTriangleCount(Mesh);
+	const TArray<FName> BonesToRemove = FindBonesToRemove(Mesh, Settings);
+
+	for (int32 LODIndex = 0; LODIndex < Mesh->GetLODNum(); ++LODIndex)
+	{
+		if (!Profile.bOverrideExisting && LODIndex < ExistingLODCount)
+		{
+			continue;
+		}
+
+		FSkeletalMeshLODInfo* LODInfo = Mesh->GetLODInfo(LODIndex);
+		FLODProfilePlatforms::ConfigureScreenSize(Profile, LODIndex, LODInfo->ScreenSize);
+
+		// LOD0 is the imported source every other LOD is reduced from, so it is never reduced in place.
+		if (LODIndex == 0)
+		{
+			continue;
+		}
+
+		FSkeletalMeshOptimizationSettings& Reduction = LODInfo->ReductionSettings;
+		Reduction.BaseLOD = 0;
+		if (Profile.bEnableReduction)
+		{
+			const float VertexPercent = Settings.VertexPercents.IsValidIndex(LODIndex) ? FMath::Clamp(Settings.VertexPercents[LODIndex], 0.0f, 100.0f) : 100.0f;
+			Reduction.NumOfTrianglesPercentage = FLODProfileApplicator::ResolveReductionPercent(Profile, LODIndex, SourceTriangles) / 100.0f;
+			Reduction.NumOfVertPercentage = VertexPercent / 100.0f;
+			Reduction.TerminationCriterion = VertexPercent < 100.0f ? SMTC_TriangleOrVert : SMTC_NumOfTriangles;
+		}
+		if (Settings.MaxBonesPerVertex.IsValidIndex(LODIndex) && Settings.MaxBonesPerVertex[LODIndex] > 0)
+		{
+			Reduction.MaxBonesPerVertex = Settings.MaxBonesPerVertex[LODIndex];
+		}
+
+		// Like bone influences, the list is only the profile's to write when it configures bone removal.
+		if (Settings.RemoveBonesFromLOD != INDEX_NONE && Settings.BonesToRemovePatterns.Num() > 0)
+		{
+			LODInfo->BonesToRemove.Reset();
+			if (LODIndex >= Settings.RemoveBonesFromLOD)
+			{
+				for (const FName BoneName : BonesToRemove)
+				{
+					LODInfo->BonesToRemove.Add(FBoneReference(BoneName));
+				}
+			}
+		}
+	}
+
+	if (FLODProfilePlatforms::HasOverrides(Profile))
+	{
+		FLODProfilePlatforms::ConfigureMinLOD(Mesh, Profile);
+	}
+}
+
+int32 FLODProfileSkeletalMesh::GetSourceTriangleCount(const USkeletalMesh* Mesh)
+{
+	const FSkeletalMeshModel* ImportedModel = Mesh->GetImportedModel();
+	if (!ImportedModel || ImportedModel->LODModels.Num() == 0)
+	{
+		return 0;
+	}
+
+	int32 NumTriangles = 0;
+	for (const FSkelMeshSection& Section : ImportedModel->LODModels[0].Sections)
+	{
+		NumTriangles += Section.NumTriangles;
+	}
+	return NumTriangles;
+}
+
+TArray<FName> FLODProfileSkeletalMesh::FindBonesToRemove(const USkeletalMesh* Mesh, const FLODProfileSkeletalSettings& Settings)
+{
+	TArray<FName> Bones;
+	if (Settings.RemoveBonesFromLOD == INDEX_NONE || Settings.BonesToRemovePatterns.Num() == 0)
+	{
+		return Bones;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = Mesh->GetRefSkeleton();
+	for (int32 BoneIndex = 1; BoneIndex < RefSkeleton.GetRawBoneNum(); ++BoneIndex)
+	{
+		const FName BoneName = RefSkeleton.GetRawBoneName(BoneIndex);
+		const FString BoneString = BoneName.ToString();
+		for (const FString& Pattern : Settings.BonesToRemovePatterns)
+		{
+			if (BoneString.MatchesWildcard(Pattern))
+			{
+				Bones.Add(BoneName);
+				break;
+			}
+		}
+	}
+	return Bones;
+}
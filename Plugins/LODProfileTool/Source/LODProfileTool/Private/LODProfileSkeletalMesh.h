@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LODProfileTypes.h"
+
+class USkeletalMesh;
+struct FLODProfileAssetReport;
+
+/**
+ * Applies LOD profiles to skeletal meshes. LOD count, screen sizes and triangle reduction come from the same profile
+ * fields as static meshes; the profile's Skeletal section adds vertex, skin influence and bone limits. Skeletal LOD
+ * generation runs synchronously on the game thread, so these meshes are processed one at a time.
+ */
+class FLODProfileSkeletalMesh
+{
+public:
+	/** Configures the LOD infos, regenerates reduced LODs and stamps the mesh, recording stage timings into OutEntry. */
+	static bool Apply(USkeletalMesh* Mesh, const FLODProfile& Profile, const FString& ProfileHash, FLODProfileAssetReport& OutEntry);
+
+	/** Triangles per LOD of the current render data. Blocks until a pending build of the mesh finishes. */
+	static TArray<int32> GetLODTriangleCounts(USkeletalMesh* Mesh);
+
+private:
+	/** Writes the profile into the LOD infos without regenerating anything. */
+	static void ConfigureLODInfos(USkeletalMesh* Mesh, const FLODProfile& Profile, int32 ExistingLODCount);
+
+	/** Triangles of the imported LOD0 model, which the reduction uses as its base. */
+	static int32 GetSourceTriangleCount(const USkeletalMesh* Mesh);
+
+	/** Bones of the reference skeleton matching the profile's removal patterns. The root bone is never matched. */
+	static TArray<FName> FindBonesToRemove(const USkeletalMesh* Mesh, const FLODProfileSkeletalSettings& Settings);
+};
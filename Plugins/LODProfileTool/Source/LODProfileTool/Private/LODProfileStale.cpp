@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileStale.h"
+
+#include "LODProfileApplicator.h"
+#include "LODProfileAsset.h"
+#include "LODProfileRuleSet.h"
+#include "LODProfileStamp.h"
+#include "LODProfileTool.h"
+#include "LODProfileToolSettings.h"
+
+int32 FLODProfileStaleScan::CountStale() const
+{
+	int32 Count = 0;
+	for (const FLODProfileStaleGroup& Group : Groups)
+	{
+		Count += Group.Assets.Num();
+	}
+	return Count;
+}
+
+FString FLODProfileStaleScan::ToString() const
+{
+	return FString::Printf(TEXT("%d stale mesh(es) from %d profile(s), %d up to date, %d untracked, %d with a missing profile."),
+		CountStale(), Groups.Num(), NumUpToDate, NumUntracked, Unresolved.Num());
+}
+
+FLODProfileStaleScan FLODProfileStale::Scan(const TArray<FAssetData>& Assets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_ScanStale);
+
+	struct FResolvedSource
+	{
+		bool bValid = false;
+		FString Hash;
+		int32 GroupIndex = INDEX_NONE;
+	};
+	TMap<FString, FResolvedSource> Sources;
+
+	FLODProfileStaleScan Scan;
+	for (const FAssetData& AssetData : Assets)
+	{
+		FString Source;
+		FString StampedHash;
+		if (!AssetData.GetTagValue(FLODProfileStamp::ProfileSourceTag, Source) || Source.IsEmpty()
+			|| !AssetData.GetTagValue(FLODProfileStamp::ProfileHashTag, StampedHash))
+		{
+			++Scan.NumUntracked;
+			continue;
+		}
+
+		FResolvedSource* Resolved = Sources.Find(Source);
+		if (!Resolved)
+		{
+			Resolved = &Sources.Add(Source);
+			FLODProfileStaleGroup Group;
+			Group.Source = Source;
+			Resolved->bValid = ResolveSource(Source, Group.Profile, Group.Version);
+			if (Resolved->bValid)
+			{
+				Resolved->Hash = FLODProfileStamp::HashProfile(Group.Profile);
+				Resolved->GroupIndex = Scan.Groups.Add(MoveTemp(Group));
+			}
+		}
+
+		if (!Resolved->bValid)
+		{
+			Scan.Unresolved.Add(AssetData);
+		}
+		else if (StampedHash == Resolved->Hash)
+		{
+			++Scan.NumUpToDate;
+		}
+		else
+		{
+			Scan.Groups[Resolved->GroupIndex].Assets.Add(AssetData);
+		}
+	}
+
+	Scan.Groups.RemoveAll([](const FLODProfileStaleGroup& Group) { return Group.Assets.IsEmpty(); });
+	return Scan;
+}
+
+bool FLODProfileStale::ResolveSource(const FString& Source, FLODProfile& OutProfile, int32& OutVersion)
+{
+	const ULODProfileToolSettings* Settings = ULODProfileToolSettings::Get();
+	OutVersion = 0;
+
+	// Library assets are stamped with their object path; everything else names a profile from project settings.
+	if (Source.StartsWith(TEXT("/")))
+	{
+		const ULODProfileAsset* ProfileAsset = LoadObject<ULODProfileAsset>(nullptr, *Source);
+		if (!ProfileAsset)
+		{
+			UE_LOG(LogLODProfileTool, Warning, TEXT("LOD profile asset %s no longer exists."), *Source);
+			return false;
+		}
+		OutProfile = ProfileAsset->GetSanitizedProfile();
+		OutVersion = ProfileAsset->Version;
+	}
+	else if (const FLODProfile* NamedProfile = Settings->NamedProfiles.Find(FName(*Source)))
+	{
+		OutProfile = *NamedProfile;
+		ULODProfileToolSettings::SanitizeProfile(OutProfile);
+	}
+	else if (Source == FLODProfileRuleSet::FallbackProfileName.ToString())
+	{
+		OutProfile = Settings->BuildProfile();
+	}
+	else
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Named LOD profile '%s' no longer exists."), *Source);
+		return false;
+	}
+
+	FString Error;
+	if (!FLODProfileApplicator::ValidateProfile(OutProfile, Error))
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("LOD profile '%s' is invalid: %s"), *Source, *Error);
+		return false;
+	}
+	return true;
+}
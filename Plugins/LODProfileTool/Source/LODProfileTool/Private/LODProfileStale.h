@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "LODProfileTypes.h"
+
+/** Stale meshes that were built from the same profile source. */
+struct FLODProfileStaleGroup
+{
+	/** Library asset path, named profile or Default, as stamped on the meshes. */
+	FString Source;
+
+	/** Current version of the library asset; 0 for profiles from project settings. */
+	int32 Version = 0;
+
+	/** Current content of the profile the meshes are rebuilt with. */
+	FLODProfile Profile;
+
+	TArray<FAssetData> Assets;
+};
+
+/** Result of comparing mesh stamps against the current state of their profiles. */
+struct FLODProfileStaleScan
+{
+	TArray<FLODProfileStaleGroup> Groups;
+
+	/** Meshes without a profile source: never stamped, stamped before sources were recorded, or built from an ad-hoc profile. */
+	int32 NumUntracked = 0;
+
+	/** Meshes whose profile source no longer exists or is invalid. */
+	TArray<FAssetData> Unresolved;
+
+	int32 NumUpToDate = 0;
+
+	int32 CountStale() const;
+
+	/** One-line summary for logs and the tab. */
+	FString ToString() const;
+};
+
+/**
+ * Finds meshes whose LODs were built from an older state of their profile. Reads only the LODProfileSource and
+ * LODProfileHash asset registry tags of the meshes; each distinct profile source is resolved once.
+ */
+class FLODProfileStale
+{
+public:
+	/** Groups the stale meshes among Assets by profile source. */
+	static FLODProfileStaleScan Scan(const TArray<FAssetData>& Assets);
+
+	/** Loads the current profile for a stamped source. Returns false when the source no longer resolves to a valid profile. */
+	static bool ResolveSource(const FString& Source, FLODProfile& OutProfile, int32& OutVersion);
+};
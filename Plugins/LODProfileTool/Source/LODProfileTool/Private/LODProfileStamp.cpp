@@ -0,0 +1,198 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LODProfileStamp.h"
+
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkinnedAssetCommon.h"
+#include "Engine/StaticMesh.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/SecureHash.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+
+const FName FLODProfileStamp::ProfileHashTag(TEXT("LODProfileHash"));
+const FName FLODProfileStamp::SourceHashTag(TEXT("LODProfileSourceHash"));
+const FName FLODProfileStamp::ProfileSourceTag(TEXT("LODProfileSource"));
+const FName FLODProfileStamp::ProfileVersionTag(TEXT("LODProfileVersion"));
+
+namespace
+{
+	FString HashString(const FString& Text)
+	{
+		const FTCHARToUTF8 Utf8(*Text);
+		FSHAHash Hash;
+		FSHA1::HashBuffer(Utf8.Get(), Utf8.Length(), Hash.Hash);
+		return Hash.ToString();
+	}
+
+	template <typename StructType>
+	void AppendStructText(FString& Out, const StructType& Value)
+	{
+		StructType::StaticStruct()->ExportText(Out, &Value, nullptr, nullptr, PPF_None, nullptr);
+		Out += TEXT(";");
+	}
+}
+
+void FLODProfileStamp::RegisterAssetRegistryTags()
+{
+	TSet<FName>& Tags = UObject::GetMetaDataTagsForAssetRegistry();
+	Tags.Add(ProfileHashTag);
+	Tags.Add(SourceHashTag);
+	Tags.Add(ProfileSourceTag);
+	Tags.Add(ProfileVersionTag);
+}
+
+void FLODProfileStamp::UnregisterAssetRegistryTags()
+{
+	TSet<FName>& Tags = UObject::GetMetaDataTagsForAssetRegistry();
+	Tags.Remove(ProfileHashTag);
+	Tags.Remove(SourceHashTag);
+	Tags.Remove(ProfileSourceTag);
+	Tags.Remove(ProfileVersionTag);
+}
+
+FString FLODProfileStamp::HashProfile(const FLODProfile& Profile)
+{
+	// Export every UPROPERTY so new profile fields are covered without touching this function.
+	FString Text;
+	AppendStructText(Text, Profile);
+	return HashString(Text);
+}
+
+FString FLODProfileStamp::HashSourceModels(const UStaticMesh* Mesh)
+{
+	if (!Mesh)
+	{
+		return FString();
+	}
+
+	FString Text = FString::Printf(TEXT("%d;%d;"), Mesh->GetNumSourceModels(), Mesh->bAutoComputeLODScreenSize ? 1 : 0);
+	for (int32 LODIndex = 0; LODIndex < Mesh->GetNumSourceModels(); ++LODIndex)
+	{
+		const FStaticMeshSourceModel& SourceModel = Mesh->GetSourceModel(LODIndex);
+		AppendStructText(Text, SourceModel.ScreenSize);
+		AppendStructText(Text, SourceModel.ReductionSettings);
+	}
+	return HashString(Text);
+}
+
+FString FLODProfileStamp::HashSourceModels(const USkeletalMesh* Mesh)
+{
+	if (!Mesh)
+	{
+		return FString();
+	}
+
+	FString Text = FString::Printf(TEXT("%d;"), Mesh->GetLODNum());
+	for (int32 LODIndex = 0; LODIndex < Mesh->GetLODNum(); ++LODIndex)
+	{
+		const FSkeletalMeshLODInfo* LODInfo = Mesh->GetLODInfo(LODIndex);
+		AppendStructText(Text, LODInfo->ScreenSize);
+		AppendStructText(Text, LODInfo->ReductionSettings);
+		for (const FBoneReference& Bone : LODInfo->BonesToRemove)
+		{
+			Text += Bone.BoneName.ToString() + TEXT(",");
+		}
+		Text += TEXT(";");
+	}
+	return HashString(Text);
+}
+
+bool FLODProfileStamp::IsStampedWith(const FAssetData& AssetData, const FString& ProfileHash)
+{
+	FString StampedHash;
+	return AssetData.GetTagValue(ProfileHashTag, StampedHash) && StampedHash == ProfileHash;
+}
+
+bool FLODProfileStamp::IsUpToDate(const UStaticMesh* Mesh, const FString& ProfileHash)
+{
+	if (!Mesh || Read(Mesh, ProfileHashTag) != ProfileHash)
+	{
+		return false;
+	}
+	return Read(Mesh, SourceHashTag) == HashSourceModels(Mesh);
+}
+
+bool FLODProfileStamp::IsUpToDate(const USkeletalMesh* Mesh, const FString& ProfileHash)
+{
+	if (!Mesh || Read(Mesh, ProfileHashTag) != ProfileHash)
+	{
+		return false;
+	}
+	return Read(Mesh, SourceHashTag) == HashSourceModels(Mesh);
+}
+
+void FLODProfileStamp::Write(UStaticMesh* Mesh, const FString& ProfileHash)
+{
+	if (Mesh)
+	{
+		WriteValues(Mesh, ProfileHash, HashSourceModels(Mesh));
+	}
+}
+
+void FLODProfileStamp::Write(USkeletalMesh* Mesh, const FString& ProfileHash)
+{
+	if (Mesh)
+	{
+		WriteValues(Mesh, ProfileHash, HashSourceModels(Mesh));
+	}
+}
+
+void FLODProfileStamp::WriteValues(UObject* Mesh, const FString& ProfileHash, const FString& SourceHash)
+{
+#if UE_VERSION_OLDER_THAN(5, 6, 0)
+	UMetaData* MetaData = Mesh->GetOutermost()->GetMetaData();
+	MetaData->SetValue(Mesh, ProfileHashTag, *ProfileHash);
+	MetaData->SetValue(Mesh, SourceHashTag, *SourceHash);
+#else
+	FMetaData& MetaData = Mesh->GetOutermost()->GetMetaData();
+	MetaData.SetValue(Mesh, ProfileHashTag, *ProfileHash);
+	MetaData.SetValue(Mesh, SourceHashTag, *SourceHash);
+#endif
+}
+
+void FLODProfileStamp::WriteSource(UObject* Mesh, const FString& ProfileSource, int32 ProfileVersion)
+{
+	if (!Mesh)
+	{
+		return;
+	}
+
+	const FString Version = FString::FromInt(ProfileVersion);
+#if UE_VERSION_OLDER_THAN(5, 6, 0)
+	UMetaData* MetaData = Mesh->GetOutermost()->GetMetaData();
+	if (ProfileSource.IsEmpty())
+	{
+		MetaData->RemoveValue(Mesh, ProfileSourceTag);
+		MetaData->RemoveValue(Mesh, ProfileVersionTag);
+		return;
+	}
+	MetaData->SetValue(Mesh, ProfileSourceTag, *ProfileSource);
+	MetaData->SetValue(Mesh, ProfileVersionTag, *Version);
+#else
+	FMetaData& MetaData = Mesh->GetOutermost()->GetMetaData();
+	if (ProfileSource.IsEmpty())
+	{
+		MetaData.RemoveValue(Mesh, ProfileSourceTag);
+		MetaData.RemoveValue(Mesh, ProfileVersionTag);
+		return;
+	}
+	MetaData.SetValue(Mesh, ProfileSourceTag, *ProfileSource);
+	MetaData.SetValue(Mesh, ProfileVersionTag, *Version);
+#endif
+}
+
+FString FLODProfileStamp::Read(const UObject* Mesh, FName Key)
+{
+	if (!Mesh)
+	{
+		return FString();
+	}
+
+#if UE_VERSION_OLDER_THAN(5, 6, 0)
+	const FString* Value = Mesh->GetOutermost()->GetMetaData()->FindValue(Mesh, Key);
+#else
+	const FString* Value = Mesh->GetOutermost()->GetMetaData().FindValue(Mesh, Key);
+#endif
+	return Value ? *Value : FString();
+}
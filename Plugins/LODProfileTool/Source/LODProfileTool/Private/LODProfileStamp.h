@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "LODProfileTypes.h"
+
+class UStaticMesh;
+class USkeletalMesh;
+
+/**
+ * Records which profile produced a mesh's LOD settings. The stamp lives in package metadata and
+ * is exported as asset registry tags, so up-to-date meshes can be recognized without loading them.
+ */
+class FLODProfileStamp
+{
+public:
+	/** Hash of the FLODProfile that was applied. */
+	static const FName ProfileHashTag;
+
+	/** Hash of the source model settings the profile produced. Detects later hand edits. */
+	static const FName SourceHashTag;
+
+	/** Profile library asset path or named profile the mesh was built from. */
+	static const FName ProfileSourceTag;
+
+	/** Version of the profile library asset when the mesh was built. */
+	static const FName ProfileVersionTag;
+
+	/** Exports the stamp metadata keys as asset registry tags. Call once on module startup. */
+	static void RegisterAssetRegistryTags();
+	static void UnregisterAssetRegistryTags();
+
+	/** Content hash over every property of the profile. */
+	static FString HashProfile(const FLODProfile& Profile);
+
+	/** Content hash over the LOD-relevant source model settings of the mesh. */
+	static FString HashSourceModels(const UStaticMesh* Mesh);
+
+	/** Content hash over the LOD-relevant LOD info settings of a skeletal mesh. */
+	static FString HashSourceModels(const USkeletalMesh* Mesh);
+
+	/** True when the asset registry reports the asset was stamped with ProfileHash. Never loads the asset. */
+	static bool IsStampedWith(const FAssetData& AssetData, const FString& ProfileHash);
+
+	/** True when the loaded mesh was stamped with ProfileHash and its source models were not edited since. */
+	static bool IsUpToDate(const UStaticMesh* Mesh, const FString& ProfileHash);
+	static bool IsUpToDate(const USkeletalMesh* Mesh, const FString& ProfileHash);
+
+	/** Stamps the mesh with the profile hash and its current source model hash. */
+	static void Write(UStaticMesh* Mesh, const FString& ProfileHash);
+	static void Write(USkeletalMesh* Mesh, const FString& ProfileHash);
+
+	/** Records which profile source and version built the mesh. An empty source clears both values. */
+	static void WriteSource(UObject* Mesh, const FString& ProfileSource, int32 ProfileVersion);
+
+	/** Reads a stamp value from the package metadata of a loaded mesh. Returns an empty string when missing. */
+	static FString Read(const UObject* Mesh, FName Key);
+
+private:
+	static void WriteValues(UObject* Mesh, const FString& ProfileHash, const FString& SourceHash);
+};
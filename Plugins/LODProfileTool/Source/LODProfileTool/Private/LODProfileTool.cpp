@@ -2,7 +2,14 @@
 
 #include "LODProfileTool.h"
 
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
 #include "LODProfileApplicator.h"
+#include "LODProfileBackgroundJob.h"
+#include "LODProfileImportHook.h"
+#include "LODProfileRuleSet.h"
+#include "LODProfileStale.h"
+#include "LODProfileStamp.h"
 #include "LODProfileToolSettings.h"
 #include "SLODProfileToolWidget.h"
 #include "ToolMenus.h"
@@ -17,6 +24,7 @@
 #include "Textures/SlateIcon.h"
 #include "Styling/AppStyle.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Misc/CoreDelegates.h"
 
 #define LOCTEXT_NAMESPACE "FLODProfileToolModule"
 
@@ -26,6 +34,10 @@ static const FName LODProfileTabName = TEXT("LODProfileTool");
 
 void FLODProfileToolModule::StartupModule()
 {
+	FLODProfileStamp::RegisterAssetRegistryTags();
+	FLODProfileImportHook::Register();
+	FCoreDelegates::OnEnginePreExit.AddRaw(this, &FLODProfileToolModule::OnEnginePreExit);
+
 	FToolMenuOwnerScoped OwnerScoped(this);
 	UToolMenus::RegisterStartupCallback(
 		FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FLODProfileToolModule::RegisterMenus));
@@ -40,6 +52,16 @@ void FLODProfileToolModule::StartupModule()
 
 void FLODProfileToolModule::ShutdownModule()
 {
+	FCoreDelegates::OnEnginePreExit.RemoveAll(this);
+	if (UObjectInitialized())
+	{
+		// Pre-exit already drained them on a normal exit; this covers the module being unloaded on its own.
+		FLODProfileBackgroundJob::CancelAll();
+	}
+
+	FLODProfileStamp::UnregisterAssetRegistryTags();
+	FLODProfileImportHook::Unregister();
+
 	if (UToolMenus* Menus = UToolMenus::Get())
 	{
 		Menus->UnregisterOwner(this);
@@ -51,6 +73,11 @@ void FLODProfileToolModule::ShutdownModule()
 	}
 }
 
+void FLODProfileToolModule::OnEnginePreExit()
+{
+	FLODProfileBackgroundJob::CancelAll();
+}
+
 void FLODProfileToolModule::InvokeTab()
 {
 	FGlobalTabmanager::Get()->TryInvokeTab(LODProfileTabName);
@@ -67,13 +94,117 @@ TSharedRef<SDockTab> FLODProfileToolModule::SpawnLODProfileTab(const FSpawnTabAr
 
 void FLODProfileToolModule::RegisterMenus()
 {
-	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu("ContentBrowser.AssetContextMenu.StaticMesh");
+	for (const FName MenuName : { FName("ContentBrowser.AssetContextMenu.StaticMesh"), FName("ContentBrowser.AssetContextMenu.SkeletalMesh") })
+	{
+		RegisterAssetMenu(MenuName);
+	}
+
+	UToolMenu* FolderMenu = UToolMenus::Get()->ExtendMenu("ContentBrowser.FolderContextMenu");
+	FToolMenuSection& FolderSection = FolderMenu->AddSection("LODProfileTool", LOCTEXT("LODProfileToolMenuLabel", "LOD Tools"));
+	FolderSection.AddMenuEntry(
+		"ApplyLODProfileToFolder",
+		LOCTEXT("ApplyLODProfileToFolder_Label", "Apply LOD Profile to Folder"),
+		LOCTEXT("ApplyLODProfileToFolder_Tooltip", "Apply the configured LOD profile to every static and skeletal mesh in the selected folders, in bounded-memory windows when auto-save is enabled."),
+		FSlateIcon(),
+		FToolMenuExecuteAction::CreateLambda([](const FToolMenuContext& Context)
+		{
+			if (const UContentBrowserFolderContext* FolderContext = Context.FindContext<UContentBrowserFolderContext>())
+			{
+				const TArray<FString>& PackagePaths = FolderContext->GetSelectedPackagePaths();
+				if (PackagePaths.IsEmpty())
+				{
+					return;
+				}
+
+				const ULODProfileToolSettings* Settings = ULODProfileToolSettings::Get();
+				FLODProfile Profile = Settings->BuildProfile();
+
+				FString Error;
+				if (!FLODProfileApplicator::ValidateProfile(Profile, Error))
+				{
+					UE_LOG(LogLODProfileTool, Error, TEXT("Profile invalid: %s"), *Error);
+					return;
+				}
+
+				FLODProfileApplyOptions Options = Settings->BuildApplyOptions();
+				Options.ProfileSource = FLODProfileRuleSet::FallbackProfileName.ToString();
+				const int32 Applied = FLODProfileApplicator::ApplyProfileToPaths(Profile, PackagePaths, /*bRecursive=*/true, Options);
+				UE_LOG(LogLODProfileTool, Log, TEXT("Applied LOD profile to %d asset(s)."), Applied);
+			}
+		})
+	);
+	FolderSection.AddMenuEntry(
+		"ApplyLODProfileRulesToFolder",
+		LOCTEXT("ApplyLODProfileRulesToFolder_Label", "Apply LOD Profile Rules to Folder"),
+		LOCTEXT("ApplyLODProfileRulesToFolder_Tooltip", "Apply the named profile chosen by the project's rule table to every static and skeletal mesh in the selected folders."),
+		FSlateIcon(),
+		FToolMenuExecuteAction::CreateLambda([](const FToolMenuContext& Context)
+		{
+			if (const UContentBrowserFolderContext* FolderContext = Context.FindContext<UContentBrowserFolderContext>())
+			{
+				const TArray<FString>& PackagePaths = FolderContext->GetSelectedPackagePaths();
+				if (PackagePaths.IsEmpty())
+				{
+					return;
+				}
+
+				TArray<FAssetData> Assets;
+				FLODProfileApplicator::GatherAssets(PackagePaths, { UStaticMesh::StaticClass()->GetClassPathName(), USkeletalMesh::StaticClass()->GetClassPathName() }, /*bRecursive=*/true, Assets);
+
+				const FLODProfileRuleSet RuleSet = FLODProfileRuleSet::FromSettings();
+				const int32 Applied = FLODProfileApplicator::ApplyProfileRules(RuleSet, Assets, ULODProfileToolSettings::Get()->BuildApplyOptions());
+				UE_LOG(LogLODProfileTool, Log, TEXT("Applied LOD profile rules to %d asset(s)."), Applied);
+			}
+		})
+	);
+	FolderSection.AddMenuEntry(
+		"RebuildStaleLODsInFolder",
+		LOCTEXT("RebuildStaleLODsInFolder_Label", "Rebuild Stale LODs in Folder"),
+		LOCTEXT("RebuildStaleLODsInFolder_Tooltip", "Rebuild only the meshes in the selected folders whose LODs were built from an older state of their profile."),
+		FSlateIcon(),
+		FToolMenuExecuteAction::CreateLambda([](const FToolMenuContext& Context)
+		{
+			if (const UContentBrowserFolderContext* FolderContext = Context.FindContext<UContentBrowserFolderContext>())
+			{
+				const TArray<FString>& PackagePaths = FolderContext->GetSelectedPackagePaths();
+				if (PackagePaths.IsEmpty())
+				{
+					return;
+				}
+
+				TArray<FAssetData> Assets;
+				FLODProfileApplicator::GatherAssets(PackagePaths, { UStaticMesh::StaticClass()->GetClassPathName(), USkeletalMesh::StaticClass()->GetClassPathName() }, /*bRecursive=*/true, Assets);
+
+				const FLODProfileStaleScan Scan = FLODProfileStale::Scan(Assets);
+				const int32 Rebuilt = FLODProfileApplicator::RebuildStale(Scan, ULODProfileToolSettings::Get()->BuildApplyOptions());
+				UE_LOG(LogLODProfileTool, Log, TEXT("Rebuilt %d stale asset(s)."), Rebuilt);
+			}
+		})
+	);
+
+	// Single Window menu entry (tab spawner menu hidden to avoid duplication)
+	UToolMenu* WindowMenu = UToolMenus::Get()->ExtendMenu("LevelEditor.MainMenu.Window");
+	FToolMenuSection& WindowSection = WindowMenu->FindOrAddSection("WindowLayout");
+	WindowSection.AddMenuEntry(
+		"OpenLODProfileToolWindow",
+		LOCTEXT("OpenLODProfileToolWindow", "LOD Profile Tool"),
+		LOCTEXT("OpenLODProfileToolWindow_Tooltip", "Open the LOD Profile Tool tab."),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "LevelEditor.Tabs.Details"),
+		FUIAction(FExecuteAction::CreateRaw(this, &FLODProfileToolModule::InvokeTab)),
+		EUserInterfaceActionType::Button,
+		NAME_None
+	);
+}
+
+void FLODProfileToolModule::RegisterAssetMenu(FName MenuName)
+{
+	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu(MenuName);
 	FToolMenuSection& Section = Menu->AddSection("LODProfileTool", LOCTEXT("LODProfileToolMenuLabel", "LOD Tools"));
 
 	FToolMenuEntry& ApplyEntry = Section.AddMenuEntry(
 		"ApplyLODProfile",
 		LOCTEXT("ApplyLODProfile_Label", "Apply LOD Profile"),
-		LOCTEXT("ApplyLODProfile_Tooltip", "Apply the configured LOD profile to selected static meshes."),
+		LOCTEXT("ApplyLODProfile_Tooltip", "Apply the configured LOD profile to the selected static and skeletal meshes."),
 		FSlateIcon(),
 		FToolMenuExecuteAction::CreateLambda([](const FToolMenuContext& Context)
 		{
@@ -99,7 +230,9 @@ void FLODProfileToolModule::RegisterMenus()
 					return;
 				}
 
-				FLODProfileApplicator::ApplyProfileToAssets(Profile, AssetContext->SelectedAssets, Settings->bAutoSaveAssets);
+				FLODProfileApplyOptions Options = Settings->BuildApplyOptions();
+				Options.ProfileSource = FLODProfileRuleSet::FallbackProfileName.ToString();
+				FLODProfileApplicator::ApplyProfileToAssets(Profile, AssetContext->SelectedAssets, Options);
 			}
 		})
 	);
@@ -115,19 +248,6 @@ void FLODProfileToolModule::RegisterMenus()
 		EUserInterfaceActionType::Button,
 		NAME_None
 	);
-
-	// Single Window menu entry (tab spawner menu hidden to avoid duplication)
-	UToolMenu* WindowMenu = UToolMenus::Get()->ExtendMenu("LevelEditor.MainMenu.Window");
-	FToolMenuSection& WindowSection = WindowMenu->FindOrAddSection("WindowLayout");
-	WindowSection.AddMenuEntry(
-		"OpenLODProfileToolWindow",
-		LOCTEXT("OpenLODProfileToolWindow", "LOD Profile Tool"),
-		LOCTEXT("OpenLODProfileToolWindow_Tooltip", "Open the LOD Profile Tool tab."),
-		FSlateIcon(FAppStyle::GetAppStyleSetName(), "LevelEditor.Tabs.Details"),
-		FUIAction(FExecuteAction::CreateRaw(this, &FLODProfileToolModule::InvokeTab)),
-		EUserInterfaceActionType::Button,
-		NAME_None
-	);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -12,12 +12,33 @@ ULODProfileToolSettings::ULODProfileToolSettings()
 	DefaultNumLODs = 3;
 	bDefaultEnableReduction = true;
 	bDefaultOverrideExisting = true;
+	DefaultReductionMode = ELODProfileReductionMode::Percent;
+	bDefaultDeriveScreenSizesFromError = false;
+	DefaultMaxPixelError = 1.0f;
+	DefaultReferenceScreenHeight = 1080.0f;
 	bWarnOnOverwrite = true;
 	bAutoSaveAssets = false;
+	bAsyncSave = true;
+	bBatchBuild = true;
+	MaxConcurrentBuilds = 0;
+	bSkipUnchangedMeshes = true;
+	MinTrianglesToProcess = 0;
+	MaxAssetsPerWindow = 200;
+	MemoryBudgetMB = 4096;
+	bApplyInBackground = true;
+	BackgroundFrameBudgetMs = 8.0f;
+	bWriteRunReports = true;
+	bApplyDefaultProfileToUnmatched = false;
+	bApplyProfileOnImport = false;
+	AuditMaxTriangleRatio = 0.9f;
+	AuditMinLOD1Triangles = 32;
+	AuditMissingLODsTriangleThreshold = 5000;
 
 	// Reasonable defaults
 	DefaultScreenSizes = {1.0f, 0.5f, 0.25f};
 	DefaultReductionPercents = {100.0f, 60.0f, 35.0f};
+	DefaultTriangleBudgets = {0, 5000, 1500};
+	DefaultTriangleDensities = {0.0f, 20000.0f, 20000.0f};
 }
 
 FText ULODProfileToolSettings::GetSectionText() const
@@ -38,7 +59,24 @@ FLODProfile ULODProfileToolSettings::BuildProfile() const
 	Profile.ReductionPercents = DefaultReductionPercents;
 	Profile.bEnableReduction = bDefaultEnableReduction;
 	Profile.bOverrideExisting = bDefaultOverrideExisting;
+	Profile.ReductionMode = DefaultReductionMode;
+	Profile.TriangleBudgets = DefaultTriangleBudgets;
+	Profile.TriangleDensities = DefaultTriangleDensities;
+	Profile.bDeriveScreenSizesFromError = bDefaultDeriveScreenSizesFromError;
+	Profile.MaxPixelError = DefaultMaxPixelError;
+	Profile.ReferenceScreenHeight = DefaultReferenceScreenHeight;
+	Profile.LODSections = DefaultLODSections;
+	Profile.Nanite = DefaultNaniteSettings;
+	Profile.Skeletal = DefaultSkeletalSettings;
+	Profile.PlatformOverrides = DefaultPlatformOverrides;
+	Profile.QualityLevelMinLODs = DefaultQualityLevelMinLODs;
 
+	SanitizeProfile(Profile);
+	return Profile;
+}
+
+void ULODProfileToolSettings::SanitizeProfile(FLODProfile& Profile)
+{
 	// Ensure arrays have at least NumLODs entries; fill missing slots with sensible fallbacks
 	if (Profile.ScreenSizes.Num() < Profile.NumLODs)
 	{
@@ -59,6 +97,16 @@ FLODProfile ULODProfileToolSettings::BuildProfile() const
 		}
 	}
 
+	// Missing budgets and densities keep full detail
+	if (Profile.TriangleBudgets.Num() < Profile.NumLODs)
+	{
+		Profile.TriangleBudgets.SetNumZeroed(Profile.NumLODs);
+	}
+	if (Profile.TriangleDensities.Num() < Profile.NumLODs)
+	{
+		Profile.TriangleDensities.SetNumZeroed(Profile.NumLODs);
+	}
+
 	// Clamp ranges
 	for (float& Size : Profile.ScreenSizes)
 	{
@@ -68,5 +116,56 @@ FLODProfile ULODProfileToolSettings::BuildProfile() const
 	{
 		Percent = FMath::Clamp(Percent, 0.0f, 100.0f);
 	}
-	return Profile;
+	for (int32& Budget : Profile.TriangleBudgets)
+	{
+		Budget = FMath::Max(0, Budget);
+	}
+	for (float& Density : Profile.TriangleDensities)
+	{
+		Density = FMath::Max(0.0f, Density);
+	}
+	Profile.MaxPixelError = FMath::Max(0.01f, Profile.MaxPixelError);
+	for (FLODProfileSectionSettings& Sections : Profile.LODSections)
+	{
+		Sections.MaxSections = FMath::Max(0, Sections.MaxSections);
+	}
+	for (float& Percent : Profile.Skeletal.VertexPercents)
+	{
+		Percent = FMath::Clamp(Percent, 0.0f, 100.0f);
+	}
+	for (int32& MaxBones : Profile.Skeletal.MaxBonesPerVertex)
+	{
+		MaxBones = FMath::Clamp(MaxBones, 0, 12);
+	}
+	Profile.Skeletal.RemoveBonesFromLOD = FMath::Max(INDEX_NONE, Profile.Skeletal.RemoveBonesFromLOD);
+	Profile.Nanite.FallbackPercentTriangles = FMath::Clamp(Profile.Nanite.FallbackPercentTriangles, 0.0f, 1.0f);
+	Profile.Nanite.FallbackRelativeError = FMath::Max(0.0f, Profile.Nanite.FallbackRelativeError);
+	Profile.Nanite.KeepPercentTriangles = FMath::Clamp(Profile.Nanite.KeepPercentTriangles, 0.0f, 1.0f);
+	Profile.Nanite.TrimRelativeError = FMath::Max(0.0f, Profile.Nanite.TrimRelativeError);
+	Profile.ReferenceScreenHeight = FMath::Max(1.0f, Profile.ReferenceScreenHeight);
+}
+
+FLODProfileApplyOptions ULODProfileToolSettings::BuildApplyOptions() const
+{
+	FLODProfileApplyOptions Options;
+	Options.bAutoSave = bAutoSaveAssets;
+	Options.bAsyncSave = bAsyncSave;
+	Options.bBatchBuild = bBatchBuild;
+	Options.MaxConcurrentBuilds = FMath::Max(0, MaxConcurrentBuilds);
+	Options.bSkipUnchanged = bSkipUnchangedMeshes;
+	Options.MinTrianglesToProcess = FMath::Max(0, MinTrianglesToProcess);
+	Options.MaxAssetsPerWindow = FMath::Max(0, MaxAssetsPerWindow);
+	Options.MemoryBudgetMB = FMath::Max(0, MemoryBudgetMB);
+	Options.bWriteReport = bWriteRunReports;
+	return Options;
+}
+
+FLODProfileAuditOptions ULODProfileToolSettings::BuildAuditOptions() const
+{
+	FLODProfileAuditOptions Options;
+	Options.MaxTriangleRatio = FMath::Clamp(AuditMaxTriangleRatio, 0.1f, 1.0f);
+	Options.MinLOD1Triangles = FMath::Max(0, AuditMinLOD1Triangles);
+	Options.MissingLODsTriangleThreshold = FMath::Max(0, AuditMissingLODsTriangleThreshold);
+	Options.MaxAssetsPerWindow = FMath::Max(0, MaxAssetsPerWindow);
+	return Options;
 }
@@ -0,0 +1,421 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SLODProfileAssetTable.h"
+
+#include "Algo/Reverse.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "LODProfileApplicator.h"
+#include "LODProfileEstimate.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Input/SSegmentedControl.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
+
+namespace LODProfileAssetTable
+{
+	const FName NameColumn(TEXT("Name"));
+	const FName LODsColumn(TEXT("LODs"));
+	const FName TrianglesColumn(TEXT("Triangles"));
+	const FName TargetColumn(TEXT("Target"));
+	const FName NaniteColumn(TEXT("Nanite"));
+	const FName StatusColumn(TEXT("Status"));
+
+	/** Rows tested per frame while a filter rescans every row. */
+	constexpr int32 FilterSliceSize = 20000;
+
+	const TCHAR* GetStatusLabel(ELODProfileFilterResult Result)
+	{
+		switch (Result)
+		{
+		case ELODProfileFilterResult::Process:                return TEXT("Needs apply");
+		case ELODProfileFilterResult::UpToDate:               return TEXT("Compliant");
+		case ELODProfileFilterResult::BelowTriangleThreshold: return TEXT("Below threshold");
+		default:                                              return TEXT("Not a mesh");
+		}
+	}
+
+	FString FormatCount(int32 Count)
+	{
+		return Count == INDEX_NONE ? FString(TEXT("?")) : FString::FromInt(Count);
+	}
+
+	/** Fills the classification and target triangles of rows parallel to Assets. */
+	void EvaluateRows(TArray<TSharedPtr<FLODProfileAssetTableRow>>& Rows, const TArray<FAssetData>& Assets, const FLODProfile& Profile, const FLODProfileApplyOptions& Options)
+	{
+		const TArray<FLODProfileAssetInfo> Infos = FLODProfileAssetFilter::EvaluateAll(Assets, Profile, Options);
+		const FLODProfileEstimate Estimate = FLODProfileApplicator::EstimateProfile(Profile, Assets, Options);
+		for (int32 Index = 0; Index < Rows.Num(); ++Index)
+		{
+			FLODProfileAssetTableRow& Row = *Rows[Index];
+			Row.Info = Infos[Index];
+			const TArray<int64>& TrianglesAfter = Estimate.Meshes[Index].TrianglesAfter;
+			Row.TargetTriangles = FString::JoinBy(TrianglesAfter, TEXT(" / "), [](int64 Triangles) { return FString::Printf(TEXT("%lld"), Triangles); });
+			Row.TargetTotalTriangles = 0;
+			for (const int64 Triangles : TrianglesAfter)
+			{
+				Row.TargetTotalTriangles += Triangles;
+			}
+		}
+	}
+}
+
+/** Table row that lays out one mesh across the header's columns. */
+class SLODProfileAssetTableRowWidget : public SMultiColumnTableRow<TSharedPtr<FLODProfileAssetTableRow>>
+{
+public:
+	SLATE_BEGIN_ARGS(SLODProfileAssetTableRowWidget) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable, TSharedPtr<FLODProfileAssetTableRow> InRow)
+	{
+		Row = InRow;
+		SMultiColumnTableRow<TSharedPtr<FLODProfileAssetTableRow>>::Construct(FSuperRowType::FArguments(), OwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		using namespace LODProfileAssetTable;
+		const FLODProfileAssetInfo& Info = Row->Info;
+		FString Text;
+		if (ColumnName == NameColumn)
+		{
+			return SNew(STextBlock)
+				.Text(FText::FromName(Info.AssetData.AssetName))
+				.ToolTipText(FText::FromString(Info.AssetData.GetObjectPathString()));
+		}
+		else if (ColumnName == LODsColumn)
+		{
+			Text = FormatCount(Info.NumLODs);
+		}
+		else if (ColumnName == TrianglesColumn)
+		{
+			Text = FormatCount(Info.NumTriangles);
+		}
+		else if (ColumnName == TargetColumn)
+		{
+			Text = Row->TargetTriangles;
+		}
+		else if (ColumnName == NaniteColumn)
+		{
+			Text = Info.bNaniteEnabled ? TEXT("Yes") : TEXT("");
+		}
+		else if (ColumnName == StatusColumn)
+		{
+			Text = GetStatusLabel(Info.FilterResult);
+		}
+		return SNew(STextBlock).Text(FText::FromString(Text));
+	}
+
+private:
+	TSharedPtr<FLODProfileAssetTableRow> Row;
+};
+
+void SLODProfileAssetTable::Construct(const FArguments& InArgs)
+{
+	using namespace LODProfileAssetTable;
+
+	auto MakeColumn = [this](FName ColumnId, const TCHAR* Label, const TCHAR* ToolTip, float FillWidth)
+	{
+		return SHeaderRow::Column(ColumnId)
+			.DefaultLabel(FText::FromString(Label))
+			.DefaultTooltip(FText::FromString(ToolTip))
+			.FillWidth(FillWidth)
+			.SortMode(this, &SLODProfileAssetTable::GetSortMode, ColumnId)
+			.OnSort(this, &SLODProfileAssetTable::OnSortModeChanged);
+	};
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SNew(SSearchBox)
+				.HintText(FText::FromString(TEXT("Filter by name")))
+				.OnTextChanged(this, &SLODProfileAssetTable::OnFilterTextChanged)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(6.f, 0.f, 0.f, 0.f)
+			[
+				SNew(SSegmentedControl<EComplianceFilter>)
+				.Value_Lambda([this]() { return ComplianceFilter; })
+				.OnValueChanged(this, &SLODProfileAssetTable::SetComplianceFilter)
+				+ SSegmentedControl<EComplianceFilter>::Slot(EComplianceFilter::All)
+				.Text(FText::FromString(TEXT("All")))
+				+ SSegmentedControl<EComplianceFilter>::Slot(EComplianceFilter::NeedsApply)
+				.Text(FText::FromString(TEXT("Needs Apply")))
+				+ SSegmentedControl<EComplianceFilter>::Slot(EComplianceFilter::Compliant)
+				.Text(FText::FromString(TEXT("Compliant")))
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		.Padding(0.f, 4.f)
+		[
+			SAssignNew(ListView, SListView<TSharedPtr<FLODProfileAssetTableRow>>)
+			.ListItemsSource(&FilteredRows)
+			.SelectionMode(ESelectionMode::None)
+			.OnGenerateRow(this, &SLODProfileAssetTable::GenerateRow)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+				+ MakeColumn(NameColumn, TEXT("Name"), TEXT("Asset name; hover a row for its path."), 3.f)
+				+ MakeColumn(LODsColumn, TEXT("LODs"), TEXT("LOD count of the built render data."), 0.6f)
+				+ MakeColumn(TrianglesColumn, TEXT("LOD0 Tris"), TEXT("LOD0 triangles of the built render data."), 1.f)
+				+ MakeColumn(TargetColumn, TEXT("Target Tris per LOD"), TEXT("Triangles per LOD after applying the profile, sorted by their sum. The registry only records LOD0, so rows that would not change show their current chain assumed to halve per LOD."), 2.f)
+				+ MakeColumn(NaniteColumn, TEXT("Nanite"), TEXT("Nanite-enabled meshes only get the profile's Nanite settings."), 0.6f)
+				+ MakeColumn(StatusColumn, TEXT("Status"), TEXT("Compliance with the profile in the tab, from registry tags."), 1.f)
+			)
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(STextBlock)
+			.Text(this, &SLODProfileAssetTable::GetStatusText)
+		]
+	];
+}
+
+void SLODProfileAssetTable::SetAssets(const TArray<FAssetData>& Assets, const FLODProfile& Profile, const FLODProfileApplyOptions& Options)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_AssetTableSetAssets);
+
+	TArray<FAssetData> Meshes;
+	Meshes.Reserve(Assets.Num());
+	AllRows.Reset(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		if (AssetData.IsInstanceOf(UStaticMesh::StaticClass()) || AssetData.IsInstanceOf(USkeletalMesh::StaticClass()))
+		{
+			TSharedPtr<FLODProfileAssetTableRow> Row = MakeShared<FLODProfileAssetTableRow>();
+			Row->SearchName = AssetData.AssetName.ToString().ToLower();
+			AllRows.Add(Row);
+			Meshes.Add(AssetData);
+		}
+	}
+	LODProfileAssetTable::EvaluateRows(AllRows, Meshes, Profile, Options);
+
+	bAllRowsSorted = SortMode == EColumnSortMode::None;
+	RefreshFilter(/*bNarrowing=*/false);
+}
+
+void SLODProfileAssetTable::Reevaluate(const FLODProfile& Profile, const FLODProfileApplyOptions& Options)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_AssetTableReevaluate);
+
+	// The rows' snapshots predate the apply, so their LOD and triangle tags are stale.
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> Meshes;
+	Meshes.Reserve(AllRows.Num());
+	AllRows.RemoveAll([&AssetRegistry, &Meshes](const TSharedPtr<FLODProfileAssetTableRow>& Row)
+	{
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(Row->Info.AssetData.GetSoftObjectPath());
+		if (!AssetData.IsValid())
+		{
+			return true;
+		}
+		Meshes.Add(AssetData);
+		return false;
+	});
+	LODProfileAssetTable::EvaluateRows(AllRows, Meshes, Profile, Options);
+
+	// Status and target columns changed, so the sort and the compliance filter may no longer hold.
+	bAllRowsSorted = SortMode == EColumnSortMode::None;
+	RefreshFilter(/*bNarrowing=*/false);
+	ListView->RebuildList();
+}
+
+TArray<FAssetData> SLODProfileAssetTable::GetFilteredAssets() const
+{
+	TArray<FAssetData> Assets;
+	Assets.Reserve(FilteredRows.Num());
+	for (const TSharedPtr<FLODProfileAssetTableRow>& Row : FilteredRows)
+	{
+		Assets.Add(Row->Info.AssetData);
+	}
+	return Assets;
+}
+
+TSharedRef<ITableRow> SLODProfileAssetTable::GenerateRow(TSharedPtr<FLODProfileAssetTableRow> Row, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SLODProfileAssetTableRowWidget, OwnerTable, Row);
+}
+
+EColumnSortMode::Type SLODProfileAssetTable::GetSortMode(FName ColumnId) const
+{
+	return ColumnId == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+void SLODProfileAssetTable::OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_AssetTableSort);
+	const bool bReverseOnly = ColumnId == SortColumn && SortMode != EColumnSortMode::None && NewSortMode != SortMode;
+	SortColumn = ColumnId;
+	SortMode = NewSortMode;
+
+	if (IsFiltering())
+	{
+		// Rows still to be scanned come from AllRows, so that order has to be right first.
+		SortRows(AllRows);
+		bAllRowsSorted = true;
+		RefreshFilter(/*bNarrowing=*/false);
+		return;
+	}
+
+	// Only the visible rows are reordered now; AllRows catches up on the next full rescan.
+	if (bReverseOnly)
+	{
+		Algo::Reverse(FilteredRows);
+	}
+	else
+	{
+		SortRows(FilteredRows);
+	}
+	bAllRowsSorted = false;
+	ListView->RequestListRefresh();
+}
+
+void SLODProfileAssetTable::SortRows(TArray<TSharedPtr<FLODProfileAssetTableRow>>& Rows) const
+{
+	using namespace LODProfileAssetTable;
+	if (SortMode == EColumnSortMode::None)
+	{
+		return;
+	}
+
+	const bool bAscending = SortMode == EColumnSortMode::Ascending;
+	auto SortBy = [&Rows, bAscending](auto&& GetKey)
+	{
+		Rows.Sort([&GetKey, bAscending](const TSharedPtr<FLODProfileAssetTableRow>& A, const TSharedPtr<FLODProfileAssetTableRow>& B)
+		{
+			return bAscending ? GetKey(*A) < GetKey(*B) : GetKey(*B) < GetKey(*A);
+		});
+	};
+
+	if (SortColumn == LODsColumn)
+	{
+		SortBy([](const FLODProfileAssetTableRow& Row) { return Row.Info.NumLODs; });
+	}
+	else if (SortColumn == TrianglesColumn)
+	{
+		SortBy([](const FLODProfileAssetTableRow& Row) { return Row.Info.NumTriangles; });
+	}
+	else if (SortColumn == TargetColumn)
+	{
+		SortBy([](const FLODProfileAssetTableRow& Row) { return Row.TargetTotalTriangles; });
+	}
+	else if (SortColumn == NaniteColumn)
+	{
+		SortBy([](const FLODProfileAssetTableRow& Row) { return Row.Info.bNaniteEnabled; });
+	}
+	else if (SortColumn == StatusColumn)
+	{
+		SortBy([](const FLODProfileAssetTableRow& Row) { return uint8(Row.Info.FilterResult); });
+	}
+	else
+	{
+		SortBy([](const FLODProfileAssetTableRow& Row) -> const FString& { return Row.SearchName; });
+	}
+}
+
+void SLODProfileAssetTable::OnFilterTextChanged(const FText& InText)
+{
+	const FString NewFilterText = InText.ToString().ToLower();
+	if (NewFilterText == FilterText)
+	{
+		return;
+	}
+
+	// Rows matching the longer text are a subset of those matching the shorter one.
+	const bool bNarrowing = NewFilterText.Contains(FilterText);
+	FilterText = NewFilterText;
+	RefreshFilter(bNarrowing);
+}
+
+void SLODProfileAssetTable::SetComplianceFilter(EComplianceFilter InFilter)
+{
+	if (InFilter != ComplianceFilter)
+	{
+		const bool bNarrowing = ComplianceFilter == EComplianceFilter::All;
+		ComplianceFilter = InFilter;
+		RefreshFilter(bNarrowing);
+	}
+}
+
+bool SLODProfileAssetTable::PassesFilter(const FLODProfileAssetTableRow& Row) const
+{
+	if (ComplianceFilter == EComplianceFilter::NeedsApply && Row.Info.FilterResult != ELODProfileFilterResult::Process)
+	{
+		return false;
+	}
+	if (ComplianceFilter == EComplianceFilter::Compliant && Row.Info.FilterResult == ELODProfileFilterResult::Process)
+	{
+		return false;
+	}
+	return FilterText.IsEmpty() || Row.SearchName.Contains(FilterText, ESearchCase::CaseSensitive);
+}
+
+void SLODProfileAssetTable::RefreshFilter(bool bNarrowing)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LODProfile_AssetTableFilter);
+
+	// A narrowing filter only drops visible rows; a scan still in progress continues with the new filter.
+	if (bNarrowing)
+	{
+		FilteredRows.RemoveAll([this](const TSharedPtr<FLODProfileAssetTableRow>& Row) { return !PassesFilter(*Row); });
+		ListView->RequestListRefresh();
+		return;
+	}
+
+	if (!bAllRowsSorted)
+	{
+		SortRows(AllRows);
+		bAllRowsSorted = true;
+	}
+	FilteredRows.Reset();
+	NextRowToFilter = 0;
+	FilterNextSlice(0.0, 0.f);
+	if (IsFiltering() && !FilterTimer.IsValid())
+	{
+		FilterTimer = RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SLODProfileAssetTable::FilterNextSlice));
+	}
+}
+
+EActiveTimerReturnType SLODProfileAssetTable::FilterNextSlice(double InCurrentTime, float InDeltaTime)
+{
+	if (NextRowToFilter != INDEX_NONE)
+	{
+		const int32 EndRow = FMath::Min(AllRows.Num(), NextRowToFilter + LODProfileAssetTable::FilterSliceSize);
+		for (int32 Index = NextRowToFilter; Index < EndRow; ++Index)
+		{
+			if (PassesFilter(*AllRows[Index]))
+			{
+				FilteredRows.Add(AllRows[Index]);
+			}
+		}
+		NextRowToFilter = EndRow < AllRows.Num() ? EndRow : INDEX_NONE;
+		ListView->RequestListRefresh();
+	}
+
+	if (NextRowToFilter == INDEX_NONE)
+	{
+		FilterTimer.Reset();
+		return EActiveTimerReturnType::Stop;
+	}
+	return EActiveTimerReturnType::Continue;
+}
+
+FText SLODProfileAssetTable::GetStatusText() const
+{
+	return FText::FromString(FString::Printf(TEXT("%d of %d mesh(es) shown%s"),
+		FilteredRows.Num(), AllRows.Num(), IsFiltering() ? TEXT(" (filtering...)") : TEXT("")));
+}
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LODProfileAssetFilter.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SHeaderRow.h"
+
+class ITableRow;
+class STableViewBase;
+template <typename ItemType> class SListView;
+
+/** One mesh of the asset table. Everything is read from registry tags when the table is populated. */
+struct FLODProfileAssetTableRow
+{
+	FLODProfileAssetInfo Info;
+
+	/** Lower-case asset name, matched against the filter text. */
+	FString SearchName;
+
+	/** LOD0 triangles followed by the triangles each LOD would keep under the profile, e.g. "12000 / 7200 / 4200". */
+	FString TargetTriangles;
+
+	/** Sum of the target triangles across all LODs, the sort key of the target column. */
+	int64 TargetTotalTriangles = 0;
+};
+
+/**
+ * Virtualized table of the meshes the tab would touch: LOD count, LOD0 and target triangles, Nanite flag and
+ * compliance with the current profile. Nothing is loaded. Sorting and filtering only touch precomputed row keys, and
+ * a filter that is not a narrowing of the previous one is applied in slices across frames, so the table stays
+ * responsive with 100k rows.
+ */
+class SLODProfileAssetTable : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SLODProfileAssetTable) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Replaces the rows with the given assets, classified against the profile. Non-meshes are dropped. */
+	void SetAssets(const TArray<FAssetData>& Assets, const FLODProfile& Profile, const FLODProfileApplyOptions& Options);
+
+	/**
+	 * Re-reads the rows' assets from the asset registry, since an apply rewrites their tags, and re-classifies them
+	 * against the profile, keeping sort and filter. Rows whose asset is gone are dropped.
+	 */
+	void Reevaluate(const FLODProfile& Profile, const FLODProfileApplyOptions& Options);
+
+	/** Assets of the rows that pass the filter, in display order. */
+	TArray<FAssetData> GetFilteredAssets() const;
+
+	int32 NumRows() const { return AllRows.Num(); }
+	int32 NumFilteredRows() const { return FilteredRows.Num(); }
+
+	/** True while a filter is still being applied across frames. */
+	bool IsFiltering() const { return NextRowToFilter != INDEX_NONE; }
+
+private:
+	enum class EComplianceFilter : uint8
+	{
+		All,
+		NeedsApply,
+		Compliant
+	};
+
+	TSharedRef<ITableRow> GenerateRow(TSharedPtr<FLODProfileAssetTableRow> Row, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode);
+	EColumnSortMode::Type GetSortMode(FName ColumnId) const;
+	void OnFilterTextChanged(const FText& InText);
+	void SetComplianceFilter(EComplianceFilter InFilter);
+
+	bool PassesFilter(const FLODProfileAssetTableRow& Row) const;
+
+	/** Sorts the given rows by the current column and direction. */
+	void SortRows(TArray<TSharedPtr<FLODProfileAssetTableRow>>& Rows) const;
+
+	/** Rebuilds the filtered rows, narrowing the current ones when possible and otherwise rescanning all rows in slices. */
+	void RefreshFilter(bool bNarrowing);
+
+	EActiveTimerReturnType FilterNextSlice(double InCurrentTime, float InDeltaTime);
+
+	FText GetStatusText() const;
+
+	TArray<TSharedPtr<FLODProfileAssetTableRow>> AllRows;
+	TArray<TSharedPtr<FLODProfileAssetTableRow>> FilteredRows;
+
+	/** AllRows lags behind sort changes, which only reorder the filtered rows, until the next full rescan. */
+	bool bAllRowsSorted = true;
+
+	FName SortColumn;
+	EColumnSortMode::Type SortMode = EColumnSortMode::None;
+
+	FString FilterText;
+	EComplianceFilter ComplianceFilter = EComplianceFilter::All;
+
+	/** Next row of AllRows to test during a sliced rescan, or INDEX_NONE when the filter is complete. */
+	int32 NextRowToFilter = INDEX_NONE;
+	TSharedPtr<FActiveTimerHandle> FilterTimer;
+
+	TSharedPtr<SListView<TSharedPtr<FLODProfileAssetTableRow>>> ListView;
+};
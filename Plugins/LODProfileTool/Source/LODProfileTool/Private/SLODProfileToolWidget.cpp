@@ -3,25 +3,96 @@
 #include "SLODProfileToolWidget.h"
 
 #include "ContentBrowserModule.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
 #include "LODProfileApplicator.h"
+#include "LODProfileAsset.h"
+#include "LODProfileAssetFilter.h"
+#include "LODProfileAudit.h"
+#include "LODProfileBackgroundJob.h"
+#include "LODProfileJobJournal.h"
+#include "LODProfileRuleSet.h"
+#include "LODProfileStale.h"
+#include "LODProfileStamp.h"
 #include "LODProfileTool.h"
 #include "LODProfileToolSettings.h"
+#include "SLODProfileAssetTable.h"
+#include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
 #include "Misc/MessageDialog.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SComboBox.h"
 #include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSegmentedControl.h"
+#include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SUniformGridPanel.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Widgets/Views/SListView.h"
 #include "Widgets/Text/STextBlock.h"
 
 void SLODProfileToolWidget::Construct(const FArguments& InArgs)
 {
 	EditableProfile = ULODProfileToolSettings::Get()->BuildProfile();
 	bAutoSaveOverride = ULODProfileToolSettings::Get()->bAutoSaveAssets;
+	LoadedProfileSource = FLODProfileRuleSet::FallbackProfileName.ToString();
+	LoadedProfileHash = FLODProfileStamp::HashProfile(EditableProfile);
+	RefreshProfileLibrary();
 
 	ChildSlot
 	[
 		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(6.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock).Text(FText::FromString(TEXT("Profile")))
+			]
+			+ SHorizontalBox::Slot()
+			.Padding(8.f, 0.f)
+			.AutoWidth()
+			[
+				SAssignNew(LibraryComboBox, SComboBox<TSharedPtr<FAssetData>>)
+				.OptionsSource(&LibraryEntries)
+				.InitiallySelectedItem(SelectedLibraryEntry)
+				.ToolTipText(FText::FromString(TEXT("Load a profile library asset into the editor. Meshes applied with an unedited library profile are stamped with its path and version.")))
+				.OnGenerateWidget_Lambda([this](TSharedPtr<FAssetData> Entry)
+				{
+					return SNew(STextBlock).Text(GetLibraryEntryLabel(Entry));
+				})
+				.OnSelectionChanged_Lambda([this](TSharedPtr<FAssetData> Entry, ESelectInfo::Type SelectInfo)
+				{
+					if (SelectInfo != ESelectInfo::Direct)
+					{
+						LoadLibraryProfile(Entry);
+					}
+				})
+				[
+					SNew(STextBlock)
+					.Text_Lambda([this]() { return GetLibraryEntryLabel(SelectedLibraryEntry); })
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Refresh")))
+				.ToolTipText(FText::FromString(TEXT("Rescan the project for profile library assets.")))
+				.OnClicked_Lambda([this]()
+				{
+					RefreshProfileLibrary();
+					LibraryComboBox->RefreshOptions();
+					LibraryComboBox->SetSelectedItem(SelectedLibraryEntry);
+					return FReply::Handled();
+				})
+			]
+		]
+
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(6.f)
@@ -52,7 +123,7 @@ void SLODProfileToolWidget::Construct(const FArguments& InArgs)
 			.VAlign(VAlign_Center)
 			[
 				SAssignNew(ReductionCheckBox, SCheckBox)
-				.IsChecked(EditableProfile.bEnableReduction ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+				.IsChecked_Lambda([this]() { return EditableProfile.bEnableReduction ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
 				.OnCheckStateChanged_Lambda([this](ECheckBoxState State){ EditableProfile.bEnableReduction = State == ECheckBoxState::Checked; })
 				.Content()
 				[
@@ -63,9 +134,31 @@ void SLODProfileToolWidget::Construct(const FArguments& InArgs)
 			.AutoWidth()
 			.Padding(12.f, 0.f)
 			.VAlign(VAlign_Center)
+			[
+				SNew(SSegmentedControl<ELODProfileReductionMode>)
+				.Value_Lambda([this]() { return EditableProfile.ReductionMode; })
+				.OnValueChanged_Lambda([this](ELODProfileReductionMode Mode)
+				{
+					EditableProfile.ReductionMode = Mode;
+					RebuildLODEntries();
+				})
+				+ SSegmentedControl<ELODProfileReductionMode>::Slot(ELODProfileReductionMode::Percent)
+				.Text(FText::FromString(TEXT("Percent")))
+				.ToolTip(FText::FromString(TEXT("Same percentage of LOD0 for every mesh.")))
+				+ SSegmentedControl<ELODProfileReductionMode>::Slot(ELODProfileReductionMode::TriangleBudget)
+				.Text(FText::FromString(TEXT("Budget")))
+				.ToolTip(FText::FromString(TEXT("Absolute triangle count per LOD, resolved per mesh from its LOD0 triangles. 0 keeps full detail.")))
+				+ SSegmentedControl<ELODProfileReductionMode>::Slot(ELODProfileReductionMode::ScreenDensity)
+				.Text(FText::FromString(TEXT("Density")))
+				.ToolTip(FText::FromString(TEXT("Triangles for a mesh filling the screen, scaled by each LOD's screen size squared. 0 keeps full detail.")))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(12.f, 0.f)
+			.VAlign(VAlign_Center)
 			[
 				SAssignNew(OverrideCheckBox, SCheckBox)
-				.IsChecked(EditableProfile.bOverrideExisting ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+				.IsChecked_Lambda([this]() { return EditableProfile.bOverrideExisting ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
 				.OnCheckStateChanged_Lambda([this](ECheckBoxState State){ EditableProfile.bOverrideExisting = State == ECheckBoxState::Checked; })
 				.Content()
 				[
@@ -87,6 +180,45 @@ void SLODProfileToolWidget::Construct(const FArguments& InArgs)
 			]
 		]
 
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(6.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda([this]() { return EditableProfile.bDeriveScreenSizesFromError ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([this](ECheckBoxState State){ EditableProfile.bDeriveScreenSizesFromError = State == ECheckBoxState::Checked; })
+				.ToolTipText(FText::FromString(TEXT("After reduction, set each reduced LOD's screen size from its measured error against LOD0.")))
+				.Content()
+				[
+					SNew(STextBlock).Text(FText::FromString(TEXT("Derive Screen Sizes From Error")))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(12.f, 0.f)
+			[
+				SNew(SEditableTextBox)
+				.Text_Lambda([this]() { return FText::AsNumber(EditableProfile.MaxPixelError); })
+				.MinDesiredWidth(60.f)
+				.IsEnabled_Lambda([this]() { return EditableProfile.bDeriveScreenSizesFromError; })
+				.OnTextCommitted_Lambda([this](const FText& NewText, ETextCommit::Type)
+				{
+					EditableProfile.MaxPixelError = FMath::Max(0.01f, FCString::Atof(*NewText.ToString()));
+				})
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock).Text(FText::FromString(TEXT("Max Pixel Error")))
+			]
+		]
+
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(6.f)
@@ -105,6 +237,137 @@ void SLODProfileToolWidget::Construct(const FArguments& InArgs)
 				.Text(FText::FromString(TEXT("Apply to Selection")))
 				.OnClicked(this, &SLODProfileToolWidget::OnApplyToSelection)
 			]
+			+ SUniformGridPanel::Slot(1, 0)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Preview Selection")))
+				.OnClicked(this, &SLODProfileToolWidget::OnPreviewSelection)
+			]
+			+ SUniformGridPanel::Slot(2, 0)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Resume Last Job")))
+				.ToolTipText(FText::FromString(TEXT("Continue the most recent cancelled or interrupted auto-save run from its journal. Unavailable while a background apply is running.")))
+				.IsEnabled_Lambda([]() { return !FLODProfileBackgroundJob::IsAnyRunning(); })
+				.OnClicked(this, &SLODProfileToolWidget::OnResumeLastJob)
+			]
+			+ SUniformGridPanel::Slot(0, 1)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Estimate Selection")))
+				.ToolTipText(FText::FromString(TEXT("Predict triangle and render data savings from asset registry data, without loading or building anything.")))
+				.OnClicked(this, &SLODProfileToolWidget::OnEstimateSelection)
+			]
+			+ SUniformGridPanel::Slot(1, 1)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Export Estimate")))
+				.IsEnabled_Lambda([this]() { return LastEstimate.Meshes.Num() > 0; })
+				.OnClicked(this, &SLODProfileToolWidget::OnExportEstimate)
+			]
+			+ SUniformGridPanel::Slot(2, 1)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Audit LODs")))
+				.ToolTipText(FText::FromString(TEXT("Check the built LOD chains of the selected meshes, or of every static mesh under /Game when nothing is selected, and write a report ranked by cost.")))
+				.OnClicked(this, &SLODProfileToolWidget::OnAuditLODs)
+			]
+			+ SUniformGridPanel::Slot(0, 2)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Rebuild Stale")))
+				.ToolTipText(FText::FromString(TEXT("Rebuild the selected meshes, or every mesh under /Game when nothing is selected, whose LODs were built from an older state of their profile. Each is rebuilt with its own profile, not the one above.")))
+				.OnClicked(this, &SLODProfileToolWidget::OnRebuildStale)
+			]
+			+ SUniformGridPanel::Slot(1, 2)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("List Meshes")))
+				.ToolTipText(FText::FromString(TEXT("List the selected meshes, or every mesh under /Game when nothing is selected, with their LODs and compliance read from the asset registry.")))
+				.OnClicked(this, &SLODProfileToolWidget::OnListMeshes)
+			]
+			+ SUniformGridPanel::Slot(2, 2)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Apply to Listed")))
+				.ToolTipText(FText::FromString(TEXT("Apply the profile to the meshes that pass the list's filter.")))
+				.IsEnabled_Lambda([this]() { return AssetTable->NumFilteredRows() > 0 && !AssetTable->IsFiltering(); })
+				.OnClicked(this, &SLODProfileToolWidget::OnApplyToListed)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(6.f)
+		[
+			SAssignNew(PreviewText, STextBlock)
+			.AutoWrapText(true)
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(6.f)
+		[
+			SNew(SBox)
+			.HeightOverride(360.f)
+			.Visibility_Lambda([this]() { return AssetTable.IsValid() && AssetTable->NumRows() > 0 ? EVisibility::Visible : EVisibility::Collapsed; })
+			[
+				SAssignNew(AssetTable, SLODProfileAssetTable)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(6.f)
+		[
+			SNew(SVerticalBox)
+			.Visibility_Lambda([this]() { return ActiveJob.IsValid() ? EVisibility::Visible : EVisibility::Collapsed; })
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.VAlign(VAlign_Center)
+				[
+					SNew(SProgressBar)
+					.Percent_Lambda([this]() -> TOptional<float>
+					{
+						const int32 NumAssets = ActiveJob.IsValid() ? ActiveJob->GetAssets().Num() : 0;
+						return NumAssets > 0 ? float(ActiveJob->GetNumDone()) / NumAssets : 1.f;
+					})
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(6.f, 0.f, 0.f, 0.f)
+				[
+					SNew(SButton)
+					.Text(FText::FromString(TEXT("Cancel")))
+					.ToolTipText(FText::FromString(TEXT("Stop starting meshes. Builds in flight finish and are saved; the rest can be resumed with Resume Last Job when auto-save is on.")))
+					.IsEnabled_Lambda([this]() { return ActiveJob.IsValid() && !ActiveJob->IsFinished() && !ActiveJob->IsCancelled(); })
+					.OnClicked(this, &SLODProfileToolWidget::OnCancelBackgroundJob)
+				]
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.f, 4.f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SLODProfileToolWidget::GetBackgroundJobStatus)
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				// Rows are virtualized, so the list stays cheap for selections of any size.
+				SNew(SBox)
+				.MaxDesiredHeight(240.f)
+				[
+					SAssignNew(JobAssetList, SListView<TSharedPtr<FLODProfileBackgroundAsset>>)
+					.ListItemsSource(&ActiveJobAssets)
+					.SelectionMode(ESelectionMode::None)
+					.OnGenerateRow(this, &SLODProfileToolWidget::GenerateJobAssetRow)
+				]
+			]
 		]
 
 		+ SVerticalBox::Slot()
@@ -145,7 +408,23 @@ void SLODProfileToolWidget::RebuildLODEntries()
 TSharedRef<SWidget> SLODProfileToolWidget::BuildLODRow(int32 Index)
 {
 	const float ScreenSize = EditableProfile.ScreenSizes.IsValidIndex(Index) ? EditableProfile.ScreenSizes[Index] : 1.0f;
-	const float Reduction = EditableProfile.ReductionPercents.IsValidIndex(Index) ? EditableProfile.ReductionPercents[Index] : 100.0f;
+	float Reduction = 0.0f;
+	FString ReductionLabel;
+	switch (EditableProfile.ReductionMode)
+	{
+	case ELODProfileReductionMode::TriangleBudget:
+		Reduction = EditableProfile.TriangleBudgets.IsValidIndex(Index) ? EditableProfile.TriangleBudgets[Index] : 0;
+		ReductionLabel = TEXT("Triangles (0 = full)");
+		break;
+	case ELODProfileReductionMode::ScreenDensity:
+		Reduction = EditableProfile.TriangleDensities.IsValidIndex(Index) ? EditableProfile.TriangleDensities[Index] : 0.0f;
+		ReductionLabel = TEXT("Triangles at full screen (0 = full)");
+		break;
+	default:
+		Reduction = EditableProfile.ReductionPercents.IsValidIndex(Index) ? EditableProfile.ReductionPercents[Index] : 100.0f;
+		ReductionLabel = TEXT("% Triangles");
+		break;
+	}
 
 	TSharedPtr<SEditableTextBox> ScreenSizeBox;
 	TSharedPtr<SEditableTextBox> ReductionBox;
@@ -165,6 +444,7 @@ TSharedRef<SWidget> SLODProfileToolWidget::BuildLODRow(int32 Index)
 			SAssignNew(ScreenSizeBox, SEditableTextBox)
 			.Text(FText::AsNumber(ScreenSize))
 			.MinDesiredWidth(80.f)
+			.IsEnabled_Lambda([this, Index]() { return Index == 0 || !EditableProfile.bDeriveScreenSizesFromError; })
 			.OnTextCommitted_Lambda([this, Index](const FText& NewText, ETextCommit::Type)
 			{
 				const float Value = FCString::Atof(*NewText.ToString());
@@ -187,14 +467,25 @@ TSharedRef<SWidget> SLODProfileToolWidget::BuildLODRow(int32 Index)
 			.OnTextCommitted_Lambda([this, Index](const FText& NewText, ETextCommit::Type)
 			{
 				const float Value = FCString::Atof(*NewText.ToString());
-				EditableProfile.ReductionPercents[Index] = FMath::Clamp(Value, 0.0f, 100.0f);
+				switch (EditableProfile.ReductionMode)
+				{
+				case ELODProfileReductionMode::TriangleBudget:
+					EditableProfile.TriangleBudgets[Index] = FMath::Max(0, FMath::RoundToInt(Value));
+					break;
+				case ELODProfileReductionMode::ScreenDensity:
+					EditableProfile.TriangleDensities[Index] = FMath::Max(0.0f, Value);
+					break;
+				default:
+					EditableProfile.ReductionPercents[Index] = FMath::Clamp(Value, 0.0f, 100.0f);
+					break;
+				}
 			})
 		]
 		+ SHorizontalBox::Slot()
 		.AutoWidth()
 		.VAlign(VAlign_Center)
 		[
-			SNew(STextBlock).Text(FText::FromString(TEXT("% Triangles")))
+			SNew(STextBlock).Text(FText::FromString(ReductionLabel))
 		];
 
 	ScreenSizeTextBoxes.Add(ScreenSizeBox);
@@ -202,6 +493,66 @@ TSharedRef<SWidget> SLODProfileToolWidget::BuildLODRow(int32 Index)
 	return Row;
 }
 
+void SLODProfileToolWidget::RefreshProfileLibrary()
+{
+	const FSoftObjectPath SelectedPath = SelectedLibraryEntry.IsValid() && SelectedLibraryEntry->IsValid() ? SelectedLibraryEntry->GetSoftObjectPath() : FSoftObjectPath();
+
+	// List views reject null items, so project settings get an empty entry.
+	LibraryEntries.Reset();
+	LibraryEntries.Add(MakeShared<FAssetData>());
+	SelectedLibraryEntry = LibraryEntries[0];
+	for (const FAssetData& LibraryAsset : ULODProfileAsset::GatherLibrary())
+	{
+		LibraryEntries.Add(MakeShared<FAssetData>(LibraryAsset));
+		if (LibraryAsset.GetSoftObjectPath() == SelectedPath)
+		{
+			SelectedLibraryEntry = LibraryEntries.Last();
+		}
+	}
+}
+
+void SLODProfileToolWidget::LoadLibraryProfile(TSharedPtr<FAssetData> Entry)
+{
+	if (Entry.IsValid() && Entry->IsValid())
+	{
+		const ULODProfileAsset* ProfileAsset = Cast<ULODProfileAsset>(Entry->GetAsset());
+		if (!ProfileAsset)
+		{
+			UE_LOG(LogLODProfileTool, Error, TEXT("Could not load LOD profile asset %s"), *Entry->GetObjectPathString());
+			return;
+		}
+		EditableProfile = ProfileAsset->GetSanitizedProfile();
+		LoadedProfileSource = ProfileAsset->GetPathName();
+		LoadedProfileVersion = ProfileAsset->Version;
+	}
+	else
+	{
+		EditableProfile = ULODProfileToolSettings::Get()->BuildProfile();
+		LoadedProfileSource = FLODProfileRuleSet::FallbackProfileName.ToString();
+		LoadedProfileVersion = 0;
+	}
+
+	SelectedLibraryEntry = Entry;
+	LoadedProfileHash = FLODProfileStamp::HashProfile(EditableProfile);
+	LODCountTextBox->SetText(FText::AsNumber(EditableProfile.NumLODs));
+	RebuildLODEntries();
+}
+
+FText SLODProfileToolWidget::GetLibraryEntryLabel(TSharedPtr<FAssetData> Entry) const
+{
+	if (!Entry.IsValid() || !Entry->IsValid())
+	{
+		return FText::FromString(TEXT("(Project Settings)"));
+	}
+
+	int32 Version = 0;
+	if (Entry->GetTagValue(GET_MEMBER_NAME_CHECKED(ULODProfileAsset, Version), Version))
+	{
+		return FText::FromString(FString::Printf(TEXT("%s (v%d)"), *Entry->AssetName.ToString(), Version));
+	}
+	return FText::FromName(Entry->AssetName);
+}
+
 void SLODProfileToolWidget::SyncProfileFromUI()
 {
 	int32 NewLODCount = EditableProfile.NumLODs;
@@ -217,6 +568,8 @@ void SLODProfileToolWidget::ResizeArraysToLODCount(int32 NewCount)
 	const int32 OldReductionCount = EditableProfile.ReductionPercents.Num();
 	EditableProfile.ScreenSizes.SetNum(NewCount);
 	EditableProfile.ReductionPercents.SetNum(NewCount);
+	EditableProfile.TriangleBudgets.SetNumZeroed(NewCount);
+	EditableProfile.TriangleDensities.SetNumZeroed(NewCount);
 
 	for (int32 Index = OldScreenSizeCount; Index < NewCount; ++Index)
 	{
@@ -236,6 +589,50 @@ void SLODProfileToolWidget::ResizeArraysToLODCount(int32 NewCount)
 }
 
 FReply SLODProfileToolWidget::OnApplyToSelection()
+{
+	FContentBrowserModule& CBModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+	TArray<FAssetData> SelectedAssets;
+	CBModule.Get().GetSelectedAssets(SelectedAssets);
+	ApplyToAssets(SelectedAssets);
+	return FReply::Handled();
+}
+
+FReply SLODProfileToolWidget::OnListMeshes()
+{
+	SyncProfileFromUI();
+
+	FContentBrowserModule& CBModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+	TArray<FAssetData> Assets;
+	CBModule.Get().GetSelectedAssets(Assets);
+	Assets.RemoveAll([](const FAssetData& AssetData) { return !AssetData.IsInstanceOf<UStaticMesh>() && !AssetData.IsInstanceOf<USkeletalMesh>(); });
+	if (Assets.Num() == 0)
+	{
+		FLODProfileApplicator::GatherAssets({TEXT("/Game")}, {UStaticMesh::StaticClass()->GetClassPathName(), USkeletalMesh::StaticClass()->GetClassPathName()}, /*bRecursive=*/true, Assets);
+	}
+
+	AssetTable->SetAssets(Assets, EditableProfile, BuildApplyOptions());
+	return FReply::Handled();
+}
+
+FReply SLODProfileToolWidget::OnApplyToListed()
+{
+	ApplyToAssets(AssetTable->GetFilteredAssets());
+	return FReply::Handled();
+}
+
+FLODProfileApplyOptions SLODProfileToolWidget::BuildApplyOptions() const
+{
+	FLODProfileApplyOptions Options = ULODProfileToolSettings::Get()->BuildApplyOptions();
+	Options.bAutoSave = bAutoSaveOverride;
+	if (FLODProfileStamp::HashProfile(EditableProfile) == LoadedProfileHash)
+	{
+		Options.ProfileSource = LoadedProfileSource;
+		Options.ProfileVersion = LoadedProfileVersion;
+	}
+	return Options;
+}
+
+void SLODProfileToolWidget::ApplyToAssets(const TArray<FAssetData>& Assets)
 {
 	SyncProfileFromUI();
 
@@ -243,27 +640,222 @@ FReply SLODProfileToolWidget::OnApplyToSelection()
 	if (!FLODProfileApplicator::ValidateProfile(EditableProfile, Error))
 	{
 		UE_LOG(LogLODProfileTool, Error, TEXT("Profile invalid: %s"), *Error);
-		return FReply::Handled();
+		return;
 	}
 
+	const ULODProfileToolSettings* Settings = ULODProfileToolSettings::Get();
+	const FLODProfileApplyOptions Options = BuildApplyOptions();
+
+	const FLODProfileFilterSummary Summary = FLODProfileAssetFilter::Summarize(FLODProfileAssetFilter::EvaluateAll(Assets, EditableProfile, Options));
+	PreviewText->SetText(FText::FromString(Summary.ToString()));
+	if (Summary.NumToProcess == 0)
+	{
+		UE_LOG(LogLODProfileTool, Log, TEXT("Nothing to apply. %s"), *Summary.ToString());
+		return;
+	}
+
+	if (!ConfirmOverwriteIfNeeded(Summary.NumToProcess))
+	{
+		return;
+	}
+
+	if (Settings->bWarnOnOverwrite && EditableProfile.bOverrideExisting)
+	{
+		UE_LOG(LogLODProfileTool, Warning, TEXT("Overwrite existing LODs is enabled. Existing settings may be replaced."));
+	}
+
+	if (Settings->bApplyInBackground)
+	{
+		StartBackgroundApply(Assets, Options);
+		return;
+	}
+
+	const int32 Applied = FLODProfileApplicator::ApplyProfileToAssets(EditableProfile, Assets, Options);
+	UE_LOG(LogLODProfileTool, Log, TEXT("Applied LOD profile to %d asset(s)."), Applied);
+	if (AssetTable->NumRows() > 0)
+	{
+		AssetTable->Reevaluate(EditableProfile, Options);
+	}
+}
+
+void SLODProfileToolWidget::StartBackgroundApply(const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options)
+{
+	if (ActiveJob.IsValid() && !ActiveJob->IsFinished())
+	{
+		PreviewText->SetText(FText::FromString(TEXT("A background apply is still running. Wait for it or cancel it first.")));
+		return;
+	}
+
+	if (ActiveJob.IsValid())
+	{
+		ActiveJob->OnFinished.RemoveAll(this);
+	}
+	ActiveJob = FLODProfileBackgroundJob::Start(EditableProfile, Assets, Options, ULODProfileToolSettings::Get()->BackgroundFrameBudgetMs);
+	ActiveJob->OnFinished.AddSP(this, &SLODProfileToolWidget::OnBackgroundJobFinished);
+	ActiveJobAssets = ActiveJob->GetAssets();
+	JobAssetList->RequestListRefresh();
+}
+
+void SLODProfileToolWidget::OnBackgroundJobFinished()
+{
+	const FLODProfileApplyReport& Report = ActiveJob->GetReport();
+	PreviewText->SetText(FText::FromString(FString::Printf(TEXT("Background apply %s: %d applied, %d skipped, %d failed in %.1fs."),
+		ActiveJob->IsCancelled() ? TEXT("cancelled") : TEXT("finished"),
+		Report.CountWithStatus(ELODProfileAssetStatus::Applied),
+		Report.CountWithStatus(ELODProfileAssetStatus::Skipped),
+		Report.CountWithStatus(ELODProfileAssetStatus::Failed),
+		Report.TotalSeconds)));
+
+	if (AssetTable->NumRows() > 0)
+	{
+		AssetTable->Reevaluate(EditableProfile, BuildApplyOptions());
+	}
+}
+
+FReply SLODProfileToolWidget::OnCancelBackgroundJob()
+{
+	if (ActiveJob.IsValid())
+	{
+		ActiveJob->Cancel();
+	}
+	return FReply::Handled();
+}
+
+FText SLODProfileToolWidget::GetBackgroundJobStatus() const
+{
+	if (!ActiveJob.IsValid())
+	{
+		return FText::GetEmpty();
+	}
+
+	const double SecondsRemaining = ActiveJob->GetSecondsRemaining();
+	const FString Remaining = SecondsRemaining < 0.0 ? TEXT("estimating") : FString::Printf(TEXT("%.0fs left"), SecondsRemaining);
+	return FText::FromString(FString::Printf(TEXT("%d/%d meshes (%d building, %d failed, %d skipped from registry tags) - %.2f meshes/s, %s%s"),
+		ActiveJob->GetNumDone(), ActiveJob->GetAssets().Num(), ActiveJob->GetNumInFlight(), ActiveJob->GetNumFailed(), ActiveJob->GetNumFiltered(),
+		ActiveJob->GetAssetsPerSecond(), *Remaining,
+		ActiveJob->IsCancelled() && !ActiveJob->IsFinished() ? TEXT(" - cancelling") : TEXT("")));
+}
+
+TSharedRef<ITableRow> SLODProfileToolWidget::GenerateJobAssetRow(TSharedPtr<FLODProfileBackgroundAsset> Asset, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FLODProfileBackgroundAsset>>, OwnerTable)
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.f)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromName(Asset->AssetData.AssetName))
+			.ToolTipText(FText::FromString(Asset->AssetData.GetObjectPathString()))
+		]
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		[
+			SNew(STextBlock)
+			.Text_Lambda([Asset]() { return FText::FromString(LexToString(Asset->State)); })
+		]
+	];
+}
+
+FReply SLODProfileToolWidget::OnPreviewSelection()
+{
+	SyncProfileFromUI();
+
 	FContentBrowserModule& CBModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
 	TArray<FAssetData> SelectedAssets;
 	CBModule.Get().GetSelectedAssets(SelectedAssets);
 
-	if (!ConfirmOverwriteIfNeeded(SelectedAssets.Num()))
+	FLODProfileApplyOptions Options = ULODProfileToolSettings::Get()->BuildApplyOptions();
+	Options.bAutoSave = bAutoSaveOverride;
+
+	const FLODProfileFilterSummary Summary = FLODProfileAssetFilter::Summarize(FLODProfileAssetFilter::EvaluateAll(SelectedAssets, EditableProfile, Options));
+	PreviewText->SetText(FText::FromString(Summary.ToString()));
+	return FReply::Handled();
+}
+
+FReply SLODProfileToolWidget::OnResumeLastJob()
+{
+	if (FLODProfileBackgroundJob::IsAnyRunning())
 	{
 		return FReply::Handled();
 	}
 
-	const ULODProfileToolSettings* Settings = ULODProfileToolSettings::Get();
-	if (Settings->bWarnOnOverwrite && EditableProfile.bOverrideExisting)
+	FLODProfileJobJournal Journal;
+	if (!FLODProfileJobJournal::FindLatestResumable(Journal))
 	{
-		UE_LOG(LogLODProfileTool, Warning, TEXT("Overwrite existing LODs is enabled. Existing settings may be replaced."));
+		PreviewText->SetText(FText::FromString(TEXT("No cancelled or interrupted job to resume.")));
+		return FReply::Handled();
 	}
 
-	const bool bAutoSave = bAutoSaveOverride;
-	const int32 Applied = FLODProfileApplicator::ApplyProfileToAssets(EditableProfile, SelectedAssets, bAutoSave);
+	const int32 Applied = FLODProfileApplicator::ResumeJob(Journal);
 	UE_LOG(LogLODProfileTool, Log, TEXT("Applied LOD profile to %d asset(s)."), Applied);
+	PreviewText->SetText(FText::FromString(FString::Printf(TEXT("Job %s: %d completed, %d failed, %d pending."),
+		*Journal.JobId.ToString(), Journal.Completed.Num(), Journal.Failed.Num(), Journal.Pending.Num())));
+	return FReply::Handled();
+}
+
+FReply SLODProfileToolWidget::OnEstimateSelection()
+{
+	SyncProfileFromUI();
+
+	FContentBrowserModule& CBModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+	TArray<FAssetData> SelectedAssets;
+	CBModule.Get().GetSelectedAssets(SelectedAssets);
+
+	FLODProfileApplyOptions Options = ULODProfileToolSettings::Get()->BuildApplyOptions();
+	Options.bAutoSave = bAutoSaveOverride;
+
+	LastEstimate = FLODProfileApplicator::EstimateProfile(EditableProfile, SelectedAssets, Options);
+	PreviewText->SetText(FText::FromString(LastEstimate.ToString()));
+	return FReply::Handled();
+}
+
+FReply SLODProfileToolWidget::OnExportEstimate()
+{
+	const FString Path = LastEstimate.SaveToDefaultLocation(FString::Printf(TEXT("LODProfileEstimate_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+	PreviewText->SetText(FText::FromString(FString::Printf(TEXT("%s\nExported to %s"), *LastEstimate.ToString(), *FPaths::ConvertRelativePathToFull(Path))));
+	return FReply::Handled();
+}
+
+FReply SLODProfileToolWidget::OnAuditLODs()
+{
+	FContentBrowserModule& CBModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+	TArray<FAssetData> Assets;
+	CBModule.Get().GetSelectedAssets(Assets);
+	Assets.RemoveAll([](const FAssetData& AssetData) { return !AssetData.IsInstanceOf<UStaticMesh>(); });
+	if (Assets.Num() == 0)
+	{
+		FLODProfileApplicator::GatherAssets({TEXT("/Game")}, {UStaticMesh::StaticClass()->GetClassPathName()}, /*bRecursive=*/true, Assets);
+	}
+
+	const FLODProfileAuditReport Audit = FLODProfileAudit::Run(Assets, ULODProfileToolSettings::Get()->BuildAuditOptions());
+	const FString Path = Audit.SaveToDefaultLocation(FString::Printf(TEXT("LODProfileAudit_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+	PreviewText->SetText(FText::FromString(FString::Printf(TEXT("%s\nWrote %s"), *Audit.ToString(), *FPaths::ConvertRelativePathToFull(Path))));
+	return FReply::Handled();
+}
+
+FReply SLODProfileToolWidget::OnRebuildStale()
+{
+	FContentBrowserModule& CBModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+	TArray<FAssetData> Assets;
+	CBModule.Get().GetSelectedAssets(Assets);
+	Assets.RemoveAll([](const FAssetData& AssetData) { return !AssetData.IsInstanceOf<UStaticMesh>() && !AssetData.IsInstanceOf<USkeletalMesh>(); });
+	if (Assets.Num() == 0)
+	{
+		FLODProfileApplicator::GatherAssets({TEXT("/Game")}, {UStaticMesh::StaticClass()->GetClassPathName(), USkeletalMesh::StaticClass()->GetClassPathName()}, /*bRecursive=*/true, Assets);
+	}
+
+	const FLODProfileStaleScan Scan = FLODProfileStale::Scan(Assets);
+	if (Scan.CountStale() == 0)
+	{
+		PreviewText->SetText(FText::FromString(Scan.ToString()));
+		return FReply::Handled();
+	}
+
+	FLODProfileApplyOptions Options = ULODProfileToolSettings::Get()->BuildApplyOptions();
+	Options.bAutoSave = bAutoSaveOverride;
+	const int32 Rebuilt = FLODProfileApplicator::RebuildStale(Scan, Options);
+	PreviewText->SetText(FText::FromString(FString::Printf(TEXT("%s\nRebuilt %d mesh(es)."), *Scan.ToString(), Rebuilt)));
 	return FReply::Handled();
 }
 
@@ -3,10 +3,17 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
 #include "Widgets/SCompoundWidget.h"
+#include "LODProfileEstimate.h"
 #include "LODProfileTypes.h"
 
+class FLODProfileBackgroundJob;
+class ITableRow;
 class SEditableTextBox;
+class SLODProfileAssetTable;
+class STableViewBase;
+struct FLODProfileBackgroundAsset;
 
 /**
  * Main Slate widget for the LOD Profile Tool tab.
@@ -23,10 +30,32 @@ private:
 	void RebuildLODEntries();
 	TSharedRef<SWidget> BuildLODRow(int32 Index);
 
+	// Profile library
+	void RefreshProfileLibrary();
+	void LoadLibraryProfile(TSharedPtr<FAssetData> Entry);
+	FText GetLibraryEntryLabel(TSharedPtr<FAssetData> Entry) const;
+
 	// Actions
 	FReply OnApplyToSelection();
+	FReply OnListMeshes();
+	FReply OnApplyToListed();
+	FReply OnPreviewSelection();
+	FReply OnResumeLastJob();
+	FReply OnEstimateSelection();
+	FReply OnExportEstimate();
+	FReply OnAuditLODs();
+	FReply OnRebuildStale();
+
+	// Background apply
+	void StartBackgroundApply(const TArray<FAssetData>& Assets, const FLODProfileApplyOptions& Options);
+	void OnBackgroundJobFinished();
+	FReply OnCancelBackgroundJob();
+	FText GetBackgroundJobStatus() const;
+	TSharedRef<ITableRow> GenerateJobAssetRow(TSharedPtr<FLODProfileBackgroundAsset> Asset, const TSharedRef<STableViewBase>& OwnerTable);
 
 	// Helpers
+	void ApplyToAssets(const TArray<FAssetData>& Assets);
+	FLODProfileApplyOptions BuildApplyOptions() const;
 	void SyncProfileFromUI();
 	void ResizeArraysToLODCount(int32 NewCount);
 	bool ConfirmOverwriteIfNeeded(int32 AssetCount) const;
@@ -34,6 +63,22 @@ private:
 	FLODProfile EditableProfile;
 	bool bAutoSaveOverride = false;
 
+	/** Profile library entries. The first holds empty asset data and stands for the project settings profile. */
+	TArray<TSharedPtr<FAssetData>> LibraryEntries;
+	TSharedPtr<FAssetData> SelectedLibraryEntry;
+
+	/** Stamp identity of the loaded profile. Meshes only get it while the hash shows the profile is unedited. */
+	FString LoadedProfileSource;
+	int32 LoadedProfileVersion = 0;
+	FString LoadedProfileHash;
+
+	/** Apply running in the background, or the last one until another starts; its assets feed the progress list. */
+	TSharedPtr<FLODProfileBackgroundJob> ActiveJob;
+	TArray<TSharedPtr<FLODProfileBackgroundAsset>> ActiveJobAssets;
+
+	/** Result of the last dry run, kept for export. */
+	FLODProfileEstimate LastEstimate;
+
 	TSharedPtr<SEditableTextBox> LODCountTextBox;
 	TArray<TSharedPtr<SEditableTextBox>> ScreenSizeTextBoxes;
 	TArray<TSharedPtr<SEditableTextBox>> ReductionTextBoxes;
@@ -41,5 +86,9 @@ private:
 	TSharedPtr<class SCheckBox> OverrideCheckBox;
 	TSharedPtr<class SCheckBox> AutoSaveCheckBox;
 
+	TSharedPtr<class SComboBox<TSharedPtr<FAssetData>>> LibraryComboBox;
 	TSharedPtr<SVerticalBox> LODList;
+	TSharedPtr<class STextBlock> PreviewText;
+	TSharedPtr<SLODProfileAssetTable> AssetTable;
+	TSharedPtr<class SListView<TSharedPtr<FLODProfileBackgroundAsset>>> JobAssetList;
 };
@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Dom/JsonObject.h"
+#include "LODProfileBenchmarkCommandlet.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLODProfileBenchmarkScenarioTest, "LODProfileTool.Benchmark.Scenario",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FLODProfileBenchmarkScenarioTest::RunTest(const FString& Parameters)
+{
+	// Small enough for a presubmit run, large enough for reduction to do real work.
+	const FLODProfileBenchmarkResult Result = ULODProfileBenchmarkCommandlet::RunScenario(/*TrianglesPerMesh=*/2000, /*NumLODs=*/3, /*NumMeshes=*/2);
+
+	TestEqual(TEXT("Every synthetic mesh is applied"), Result.NumApplied, Result.NumMeshes);
+	TestTrue(TEXT("Meshes have triangles"), Result.TrianglesPerMesh > 0);
+	TestTrue(TEXT("Throughput is measured"), Result.MeshesPerSecond > 0.0);
+	TestTrue(TEXT("Peak memory growth is not negative"), Result.PeakMemoryDeltaMB >= 0.0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLODProfileBenchmarkBaselineTest, "LODProfileTool.Benchmark.CompareToBaseline",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FLODProfileBenchmarkBaselineTest::RunTest(const FString& Parameters)
+{
+	FLODProfileBenchmarkResult Baseline;
+	Baseline.Name = TEXT("Tris2000_LODs3");
+	Baseline.MeshesPerSecond = 10.0;
+	Baseline.PeakMemoryDeltaMB = 100.0;
+	const TSharedRef<FJsonObject> BaselineJson = ULODProfileBenchmarkCommandlet::ResultsToJson({ Baseline });
+
+	FLODProfileBenchmarkResult WithinTolerance = Baseline;
+	WithinTolerance.MeshesPerSecond = 9.5;
+	WithinTolerance.PeakMemoryDeltaMB = 105.0;
+	TestEqual(TEXT("Results within tolerance pass"), ULODProfileBenchmarkCommandlet::CompareToBaseline({ WithinTolerance }, BaselineJson, 10.0), 0);
+
+	FLODProfileBenchmarkResult Regressed = Baseline;
+	Regressed.MeshesPerSecond = 5.0;
+	Regressed.PeakMemoryDeltaMB = 200.0;
+	AddExpectedError(TEXT("meshes/s, baseline"), EAutomationExpectedErrorFlags::Contains, 1);
+	AddExpectedError(TEXT("MB peak, baseline"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestEqual(TEXT("Slower and larger results are both regressions"), ULODProfileBenchmarkCommandlet::CompareToBaseline({ Regressed }, BaselineJson, 10.0), 2);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/DataAsset.h"
+#include "LODProfileTypes.h"
+#include "UObject/ObjectSaveContext.h"
+#include "LODProfileAsset.generated.h"
+
+/**
+ * A named LOD profile stored as an asset, so teams can keep a library of presets under source control.
+ * Meshes built from it are stamped with its path and Version; Version increases when the asset is saved with a changed
+ * profile.
+ */
+UCLASS(BlueprintType)
+class ULODProfileAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** UObject interface */
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+	/** Profile with per-LOD arrays padded and values clamped, as applied to meshes. */
+	FLODProfile GetSanitizedProfile() const;
+
+	/** All profile assets known to the asset registry, sorted by name. Does not load them. */
+	static TArray<FAssetData> GatherLibrary();
+
+	/** What the profile is for. */
+	UPROPERTY(EditAnywhere, Category = "Profile", meta = (MultiLine = true))
+	FText Description;
+
+	UPROPERTY(EditAnywhere, Category = "Profile", meta = (ShowOnlyInnerProperties))
+	FLODProfile Profile;
+
+	/** Increases once per save that changed the profile content, however many edits went into it. */
+	UPROPERTY(VisibleAnywhere, AssetRegistrySearchable, Category = "Version")
+	int32 Version = 1;
+
+	/** Content hash of the sanitized profile as last saved, matching the hash stamped onto meshes built from it. */
+	UPROPERTY(VisibleAnywhere, AssetRegistrySearchable, Category = "Version")
+	FString ProfileHash;
+
+private:
+	/** Recomputes ProfileHash, bumping Version when it differs from the last saved one. */
+	void UpdateVersion();
+};
@@ -22,5 +22,11 @@ public:
 
 private:
 	void RegisterMenus();
+
+	/** Cancels and drains background jobs before the engine tears down the objects they use. */
+	void OnEnginePreExit();
+
+	/** Adds the LOD Tools section to the Content Browser context menu of one asset type. */
+	void RegisterAssetMenu(FName MenuName);
 	TSharedRef<SDockTab> SpawnLODProfileTab(const FSpawnTabArgs& Args);
 };
@@ -28,6 +28,15 @@ public:
 	/** Builds a profile object from current settings. */
 	FLODProfile BuildProfile() const;
 
+	/** Builds apply options from current settings. */
+	FLODProfileApplyOptions BuildApplyOptions() const;
+
+	/** Builds audit thresholds from current settings. */
+	FLODProfileAuditOptions BuildAuditOptions() const;
+
+	/** Pads per-LOD arrays up to NumLODs with fallbacks and clamps values into range. */
+	static void SanitizeProfile(FLODProfile& Profile);
+
 	/** Default number of LODs to generate. */
 	UPROPERTY(EditAnywhere, Config, Category = "Profile", meta = (ClampMin = "1", ClampMax = "8"))
 	int32 DefaultNumLODs;
@@ -40,6 +49,50 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Profile", meta = (ClampMin = "0.0", ClampMax = "100.0"))
 	TArray<float> DefaultReductionPercents;
 
+	/** How reduction amounts are specified: flat percentages, absolute triangle budgets, or screen-area density. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile")
+	ELODProfileReductionMode DefaultReductionMode;
+
+	/** Triangles per LOD in triangle budget mode (0 = full detail). */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile", meta = (ClampMin = "0", EditCondition = "DefaultReductionMode == ELODProfileReductionMode::TriangleBudget"))
+	TArray<int32> DefaultTriangleBudgets;
+
+	/** Triangles per LOD for a mesh filling the screen in screen density mode, scaled by screen size squared (0 = full detail). */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile", meta = (ClampMin = "0.0", EditCondition = "DefaultReductionMode == ELODProfileReductionMode::ScreenDensity"))
+	TArray<float> DefaultTriangleDensities;
+
+	/** Derive each reduced LOD's screen size from its measured deviation instead of DefaultScreenSizes. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile")
+	bool bDefaultDeriveScreenSizesFromError;
+
+	/** On-screen error budget in pixels for derived screen sizes. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile", meta = (ClampMin = "0.01", EditCondition = "bDefaultDeriveScreenSizesFromError"))
+	float DefaultMaxPixelError;
+
+	/** Vertical resolution in pixels the error budget refers to. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile", meta = (ClampMin = "1.0", EditCondition = "bDefaultDeriveScreenSizesFromError"))
+	float DefaultReferenceScreenHeight;
+
+	/** Per-LOD material section dropping and merging for static meshes. Entries line up with LOD indices; LOD0 is ignored. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile")
+	TArray<FLODProfileSectionSettings> DefaultLODSections;
+
+	/** Fallback and Nanite data settings applied to Nanite-enabled meshes instead of the LOD settings above. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile")
+	FLODProfileNaniteSettings DefaultNaniteSettings;
+
+	/** Vertex, skin influence and bone limits applied to skeletal meshes on top of the LOD settings above. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile")
+	FLODProfileSkeletalSettings DefaultSkeletalSettings;
+
+	/** Screen sizes and minimum LOD per target platform or platform group, e.g. Mobile. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile|Platforms")
+	TArray<FLODProfilePlatformOverride> DefaultPlatformOverrides;
+
+	/** Minimum LOD per scalability quality level, for projects that enable quality-level min LOD. */
+	UPROPERTY(EditAnywhere, Config, Category = "Profile|Platforms", meta = (ClampMin = "0"))
+	TMap<EPerQualityLevels, int32> DefaultQualityLevelMinLODs;
+
 	/** Enables triangle reduction when true. */
 	UPROPERTY(EditAnywhere, Config, Category = "Behavior")
 	bool bDefaultEnableReduction;
@@ -55,4 +108,72 @@ public:
 	/** Automatically save modified assets after applying a profile. */
 	UPROPERTY(EditAnywhere, Config, Category = "Behavior")
 	bool bAutoSaveAssets;
+
+	/** Write saved packages asynchronously so disk I/O overlaps builds that are still running. */
+	UPROPERTY(EditAnywhere, Config, Category = "Behavior", meta = (EditCondition = "bAutoSaveAssets"))
+	bool bAsyncSave;
+
+	/** Edit all meshes first and then build them together on worker threads instead of one at a time. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	bool bBatchBuild;
+
+	/** Maximum number of meshes building at once in batched mode (0 = number of worker threads). */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = "0", EditCondition = "bBatchBuild"))
+	int32 MaxConcurrentBuilds;
+
+	/** Skip meshes that already carry this profile's LOD settings instead of rebuilding and dirtying them. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	bool bSkipUnchangedMeshes;
+
+	/** Meshes whose LOD0 has fewer triangles than this are left untouched (0 = process all). */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = "0"))
+	int32 MinTrianglesToProcess;
+
+	/** With auto-save, meshes are processed in windows of this many, then released and garbage collected (0 = single window). */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = "0"))
+	int32 MaxAssetsPerWindow;
+
+	/** With auto-save, memory in MB a run may use above its starting point before the current window is flushed (0 = unlimited). */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = "0"))
+	int32 MemoryBudgetMB;
+
+	/** Apply from the LOD Profile tab without blocking the editor: builds run on worker threads while a panel shows progress. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	bool bApplyInBackground;
+
+	/** Game-thread milliseconds per frame a background apply may spend loading, editing and saving meshes. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = "1", EditCondition = "bApplyInBackground"))
+	float BackgroundFrameBudgetMs;
+
+	/** Apply the profile (or rules) to static meshes right after they are imported or reimported in the editor. */
+	UPROPERTY(EditAnywhere, Config, Category = "Import")
+	bool bApplyProfileOnImport;
+
+	/** Profiles that rules refer to by name. */
+	UPROPERTY(EditAnywhere, Config, Category = "Rules")
+	TMap<FName, FLODProfile> NamedProfiles;
+
+	/** Rules mapping meshes to named profiles, checked top to bottom; the first match wins. */
+	UPROPERTY(EditAnywhere, Config, Category = "Rules")
+	TArray<FLODProfileRule> ProfileRules;
+
+	/** Meshes matching no rule get the default profile above. When false they are left untouched. */
+	UPROPERTY(EditAnywhere, Config, Category = "Rules")
+	bool bApplyDefaultProfileToUnmatched;
+
+	/** Write a per-asset CSV/JSON report (load/edit/build/save ms, triangles before/after) for every run. */
+	UPROPERTY(EditAnywhere, Config, Category = "Diagnostics")
+	bool bWriteRunReports;
+
+	/** The audit flags a LOD that keeps more than this fraction of the previous LOD's triangles. */
+	UPROPERTY(EditAnywhere, Config, Category = "Audit", meta = (ClampMin = "0.1", ClampMax = "1.0"))
+	float AuditMaxTriangleRatio;
+
+	/** The audit flags LOD1 as collapsed below this many triangles. */
+	UPROPERTY(EditAnywhere, Config, Category = "Audit", meta = (ClampMin = "0"))
+	int32 AuditMinLOD1Triangles;
+
+	/** The audit flags non-Nanite meshes without LODs above this many triangles. */
+	UPROPERTY(EditAnywhere, Config, Category = "Audit", meta = (ClampMin = "0"))
+	int32 AuditMissingLODsTriangleThreshold;
 };
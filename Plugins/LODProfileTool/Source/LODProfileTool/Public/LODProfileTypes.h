@@ -2,8 +2,192 @@
 
 #pragma once
 
+#include "Engine/EngineTypes.h"
+#include "PerQualityLevelProperties.h"
 #include "LODProfileTypes.generated.h"
 
+/** How a profile decides how many triangles each reduced LOD keeps. */
+UENUM(BlueprintType)
+enum class ELODProfileReductionMode : uint8
+{
+	/** The same percentage of LOD0 for every mesh (ReductionPercents). */
+	Percent,
+	/** An absolute triangle count per LOD (TriangleBudgets). */
+	TriangleBudget,
+	/** Triangles per LOD scale with the screen area the LOD covers (TriangleDensities). */
+	ScreenDensity
+};
+
+/**
+ * Per-LOD material section reduction. Each section is a draw call, so distant LODs can drop or merge sections that
+ * are not worth a draw call of their own. Material slots are matched by name, with wildcards.
+ */
+USTRUCT(BlueprintType)
+struct FLODProfileSectionSettings
+{
+	GENERATED_BODY()
+
+	FLODProfileSectionSettings()
+		: bMergeSections(false)
+		, MaxSections(0)
+	{
+	}
+
+	/** Sections using material slots matching any of these patterns are removed from the LOD. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sections")
+	TArray<FString> DropMaterialSlots;
+
+	/** Merge every remaining section into the largest one, so the LOD is a single draw call with that section's material. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sections")
+	bool bMergeSections;
+
+	/** Keep at most this many sections; the smallest are merged into the largest. 0 = no limit. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sections", meta = (ClampMin = "0"))
+	int32 MaxSections;
+
+	/** True when these settings would change anything. */
+	bool HasWork() const
+	{
+		return DropMaterialSlots.Num() > 0 || bMergeSections || MaxSections > 0;
+	}
+};
+
+/**
+ * Settings applied to Nanite-enabled meshes instead of their source models. Nanite ignores authored LODs when it
+ * renders, so only the fallback mesh and the Nanite data itself are worth configuring. Only the values whose override
+ * is ticked are written; the mesh keeps its own for the rest.
+ */
+USTRUCT(BlueprintType)
+struct FLODProfileNaniteSettings
+{
+	GENERATED_BODY()
+
+	FLODProfileNaniteSettings()
+		: bApplyToNaniteMeshes(true)
+		, bOverride_FallbackTarget(false)
+		, bOverride_FallbackPercentTriangles(false)
+		, bOverride_FallbackRelativeError(false)
+		, bOverride_KeepPercentTriangles(false)
+		, bOverride_TrimRelativeError(false)
+		, FallbackTarget(ENaniteFallbackTarget::Auto)
+		, FallbackPercentTriangles(1.0f)
+		, FallbackRelativeError(1.0f)
+		, KeepPercentTriangles(1.0f)
+		, TrimRelativeError(0.0f)
+	{
+	}
+
+	/** Route Nanite-enabled meshes here and leave their source models alone. When false they get the LOD settings like any other mesh. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite")
+	bool bApplyToNaniteMeshes;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (InlineEditConditionToggle))
+	uint8 bOverride_FallbackTarget : 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (InlineEditConditionToggle))
+	uint8 bOverride_FallbackPercentTriangles : 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (InlineEditConditionToggle))
+	uint8 bOverride_FallbackRelativeError : 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (InlineEditConditionToggle))
+	uint8 bOverride_KeepPercentTriangles : 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (InlineEditConditionToggle))
+	uint8 bOverride_TrimRelativeError : 1;
+
+	/** True when any value is overridden, i.e. applying the settings can change a mesh. */
+	bool HasOverrides() const
+	{
+		return bOverride_FallbackTarget || bOverride_FallbackPercentTriangles || bOverride_FallbackRelativeError
+			|| bOverride_KeepPercentTriangles || bOverride_TrimRelativeError;
+	}
+
+	/** Which of the fallback values below drives the fallback mesh. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (EditCondition = "bOverride_FallbackTarget"))
+	ENaniteFallbackTarget FallbackTarget;
+
+	/** Fraction of triangles (0-1) kept in the fallback mesh with the PercentTriangles target. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bOverride_FallbackPercentTriangles"))
+	float FallbackPercentTriangles;
+
+	/** Maximum error of the fallback mesh, relative to the mesh size, with the RelativeError target. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (ClampMin = "0.0", EditCondition = "bOverride_FallbackRelativeError"))
+	float FallbackRelativeError;
+
+	/** Fraction of source triangles (0-1) kept in the Nanite data. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bOverride_KeepPercentTriangles"))
+	float KeepPercentTriangles;
+
+	/** Detail below this relative error is trimmed from the Nanite data (0 keeps everything). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite", meta = (ClampMin = "0.0", EditCondition = "bOverride_TrimRelativeError"))
+	float TrimRelativeError;
+};
+
+/**
+ * Skeletal-mesh-only settings. Skeletal LODs use the profile's LOD count, screen sizes and triangle reduction as well;
+ * these add vertex, skin influence and bone limits so skinning cost also drops with distance.
+ */
+USTRUCT(BlueprintType)
+struct FLODProfileSkeletalSettings
+{
+	GENERATED_BODY()
+
+	FLODProfileSkeletalSettings()
+		: RemoveBonesFromLOD(INDEX_NONE)
+	{
+	}
+
+	/** Vertex percentage per LOD (0-100). Reduction stops at whichever of the triangle or vertex limit is hit first. 100 or missing = no vertex limit. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeletal")
+	TArray<float> VertexPercents;
+
+	/** Maximum bone influences per vertex per LOD. 0 or missing leaves the LOD's current value alone. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeletal", meta = (ClampMin = "0", ClampMax = "12"))
+	TArray<int32> MaxBonesPerVertex;
+
+	/** Bones whose names match any of these wildcards (e.g. "*twist*") are removed from RemoveBonesFromLOD onwards. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeletal")
+	TArray<FString> BonesToRemovePatterns;
+
+	/**
+	 * First LOD that drops the bones matched by BonesToRemovePatterns; earlier reduced LODs get an empty list.
+	 * INDEX_NONE (or no patterns) leaves every LOD's bones to remove alone.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeletal", meta = (ClampMin = "-1"))
+	int32 RemoveBonesFromLOD;
+};
+
+/**
+ * LOD settings for one target platform, written into the mesh's per-platform properties. The engine picks the entry
+ * of the platform being cooked or run, falling back to its platform group and then to the profile's own values.
+ */
+USTRUCT(BlueprintType)
+struct FLODProfilePlatformOverride
+{
+	GENERATED_BODY()
+
+	FLODProfilePlatformOverride()
+		: MinLOD(0)
+	{
+	}
+
+	/** Platform or platform group name as used by per-platform properties, e.g. Android, IOS or Mobile. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform")
+	FName Platform;
+
+	/** Screen size per LOD (0-1) on this platform. LODs without an entry use the profile's ScreenSizes. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform")
+	TArray<float> ScreenSizes;
+
+	/**
+	 * First LOD rendered and streamed on this platform. With the engine's min LOD stripping enabled for the platform,
+	 * LODs below it are not cooked, so the platform ships NumLODs - MinLOD LODs.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform", meta = (ClampMin = "0"))
+	int32 MinLOD;
+};
+
 /**
  * Describes the full set of parameters needed to apply a LOD profile to meshes.
  */
@@ -16,6 +200,10 @@ struct FLODProfile
 		: NumLODs(1)
 		, bEnableReduction(false)
 		, bOverrideExisting(true)
+		, ReductionMode(ELODProfileReductionMode::Percent)
+		, bDeriveScreenSizesFromError(false)
+		, MaxPixelError(1.0f)
+		, ReferenceScreenHeight(1080.0f)
 	{
 		ScreenSizes.Add(1.0f);
 		ReductionPercents.Add(100.0f);
@@ -40,4 +228,162 @@ struct FLODProfile
 	/** When false, existing LODs are preserved and only missing LODs are added. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
 	bool bOverrideExisting;
+
+	/** Which per-LOD values drive reduction. Non-percent modes are resolved per mesh from its LOD0 triangle count. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Reduction")
+	ELODProfileReductionMode ReductionMode;
+
+	/** Triangle count per LOD in TriangleBudget mode. 0 keeps full detail. Meshes already under budget are not reduced. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Reduction", meta = (ClampMin = "0", EditCondition = "ReductionMode == ELODProfileReductionMode::TriangleBudget"))
+	TArray<int32> TriangleBudgets;
+
+	/**
+	 * Triangles per LOD in ScreenDensity mode for a mesh filling the whole screen; each LOD gets Density * ScreenSize^2,
+	 * using the LOD's screen size from ScreenSizes. 0 keeps full detail.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Reduction", meta = (ClampMin = "0.0", EditCondition = "ReductionMode == ELODProfileReductionMode::ScreenDensity"))
+	TArray<float> TriangleDensities;
+
+	/**
+	 * After reduction, replace the screen size of every reduced LOD with the smallest size at which its measured deviation
+	 * from LOD0 stays within MaxPixelError. ScreenSizes then only seeds LOD0 and LODs that are not reduced.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Screen Size")
+	bool bDeriveScreenSizesFromError;
+
+	/** Largest on-screen geometric error, in pixels, a reduced LOD may show before the previous LOD is used. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Screen Size", meta = (ClampMin = "0.01", EditCondition = "bDeriveScreenSizesFromError"))
+	float MaxPixelError;
+
+	/** Vertical resolution in pixels that MaxPixelError refers to. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Screen Size", meta = (ClampMin = "1.0", EditCondition = "bDeriveScreenSizesFromError"))
+	float ReferenceScreenHeight;
+
+	/**
+	 * Section reduction per LOD for static meshes. LOD0 and LODs without an entry keep their sections. A LOD with
+	 * section reduction gets its own copy of the LOD0 geometry, which its reduction settings are then applied to.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Sections")
+	TArray<FLODProfileSectionSettings> LODSections;
+
+	/** Screen sizes and minimum LOD per target platform, so low-end platforms cook and render fewer, cheaper LODs. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Platforms")
+	TArray<FLODProfilePlatformOverride> PlatformOverrides;
+
+	/** Minimum LOD per scalability quality level, used by the engine instead of the per-platform value when the project enables quality-level min LOD. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Platforms", meta = (ClampMin = "0"))
+	TMap<EPerQualityLevels, int32> QualityLevelMinLODs;
+
+	/** Used instead of the LOD settings above for Nanite-enabled meshes. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Nanite")
+	FLODProfileNaniteSettings Nanite;
+
+	/** Extra limits for skeletal meshes. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeletal")
+	FLODProfileSkeletalSettings Skeletal;
+};
+
+/**
+ * Maps meshes to a named profile. Every condition that is set must hold; rules are checked in table order and the
+ * first match wins. All conditions are read from asset registry data, so matching never loads a package.
+ */
+USTRUCT(BlueprintType)
+struct FLODProfileRule
+{
+	GENERATED_BODY()
+
+	FLODProfileRule()
+		: MinBoundsSize(0.0f)
+		, MaxBoundsSize(0.0f)
+		, MinTriangles(0)
+		, MaxTriangles(0)
+	{
+	}
+
+	/** Key of the named profile in project settings, or asset name of a profile library asset, applied to matching meshes. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rule")
+	FName ProfileName;
+
+	/** Package path wildcard such as /Game/Environment/Rocks/*. A path without wildcards matches that folder recursively. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rule")
+	FString PathGlob;
+
+	/** Asset name prefix such as SM_Rock_ (case-insensitive). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rule")
+	FString NamePrefix;
+
+	/** Largest bounding box dimension range in world units. 0 leaves a side open. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rule", meta = (ClampMin = "0.0"))
+	float MinBoundsSize;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rule", meta = (ClampMin = "0.0"))
+	float MaxBoundsSize;
+
+	/** LOD0 triangle count range. 0 leaves a side open. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rule", meta = (ClampMin = "0"))
+	int32 MinTriangles;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rule", meta = (ClampMin = "0"))
+	int32 MaxTriangles;
+
+	/** Asset registry tags the mesh must carry with the given value; "*" accepts any value. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rule")
+	TMap<FName, FString> RequiredTags;
+};
+
+/**
+ * Thresholds for auditing built LOD chains.
+ */
+struct FLODProfileAuditOptions
+{
+	/** A LOD is flagged when it keeps more than this fraction of the previous LOD's triangles. */
+	float MaxTriangleRatio = 0.9f;
+
+	/** LOD1 is flagged as collapsed below this many triangles. */
+	int32 MinLOD1Triangles = 32;
+
+	/** Meshes with a single LOD are flagged above this many triangles. */
+	int32 MissingLODsTriangleThreshold = 5000;
+
+	/** Meshes loaded and analyzed per window before garbage collection. */
+	int32 MaxAssetsPerWindow = 200;
+};
+
+/**
+ * Execution options for a profile application run. Not part of the profile itself.
+ */
+struct FLODProfileApplyOptions
+{
+	/** Save modified packages once the profile has been applied. */
+	bool bAutoSave = false;
+
+	/** Use the async package save path so file writes overlap builds that are still running. */
+	bool bAsyncSave = true;
+
+	/** Edit all source models first, then build the meshes together through the batched build path. */
+	bool bBatchBuild = true;
+
+	/** Maximum number of meshes building at once in batched mode. 0 uses the number of worker threads. */
+	int32 MaxConcurrentBuilds = 0;
+
+	/** Skip meshes that were already stamped with this profile or whose LOD settings already match it. */
+	bool bSkipUnchanged = true;
+
+	/** Meshes whose LOD0 has fewer triangles than this are left untouched. 0 disables the check. */
+	int32 MinTrianglesToProcess = 0;
+
+	/** With auto-save, meshes are loaded, built, saved and garbage collected in windows of at most this many. 0 = unlimited. */
+	int32 MaxAssetsPerWindow = 0;
+
+	/** With auto-save, a window is closed early once the process uses this much memory above its starting point. 0 = unlimited. */
+	int32 MemoryBudgetMB = 0;
+
+	/** Write a per-asset CSV/JSON report with stage timings and triangle counts to Saved/LODProfileTool/Reports. */
+	bool bWriteReport = false;
+
+	/** Profile library asset path or named profile the run applies, stamped onto each mesh. Empty for ad-hoc profiles. */
+	FString ProfileSource;
+
+	/** Version of the profile library asset at ProfileSource. 0 when the source is not an asset. */
+	int32 ProfileVersion = 0;
 };